@@ -0,0 +1,207 @@
+// Headless projectile collision benchmark.
+//
+// Scatters units over a hex grid and keeps a pool of projectiles flying
+// across it, then times the per-tick hit pass two ways: every projectile's
+// step swept against every unit, and through the CollisionGrid broad phase.
+// Checks that both find the same first hits. The speed scale multiplies
+// every projectile's speed; it also reports how many hits a plain overlap
+// test at the end of each step would have missed.
+//
+// Usage: collision_bench [ticks] [projectiles] [units] [grid radius] [speed scale]
+
+#include "../include/graphics/HexGrid.h"
+#include "../include/projectiles/ProjectilePool.h"
+#include "../include/projectiles/CollisionGrid.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    // Matches a soldier's hit box
+    constexpr float UNIT_SIZE = 15.0f;
+    constexpr float CELL_SIZE = 50.0f;
+    constexpr float TICK_SECONDS = 1.0f / 60.0f;
+
+    using Clock = std::chrono::steady_clock;
+
+    // Square box of halfSize centered on position
+    sf::FloatRect boxAt(const sf::Vector2f& position, float halfSize) {
+        return sf::FloatRect(position - sf::Vector2f(halfSize, halfSize), {2.f * halfSize, 2.f * halfSize});
+    }
+
+    // The first unit of another allegiance the moving box touches, found by
+    // sweeping against every one of them
+    CollisionGrid::Hit findFirstHitBruteForce(const sf::Vector2f& from, const sf::Vector2f& to, float halfSize,
+                                              Allegiance allegiance, const std::vector<sf::FloatRect>& units,
+                                              const std::vector<Allegiance>& allegiances, std::size_t& tests) {
+        CollisionGrid::Hit hit;
+        sf::Vector2f delta = to - from;
+        for (std::uint32_t unit = 0; unit < units.size(); ++unit) {
+            if (allegiances[unit] == allegiance) {
+                continue;
+            }
+            tests++;
+
+            // Slab test against the unit grown by the box's half size
+            const sf::FloatRect& bounds = units[unit];
+            float enter = 0.f;
+            float exit = 1.f;
+            bool overlaps = true;
+            const float start[2] = {from.x, from.y};
+            const float step[2] = {delta.x, delta.y};
+            const float min[2] = {bounds.position.x - halfSize, bounds.position.y - halfSize};
+            const float max[2] = {bounds.position.x + bounds.size.x + halfSize, bounds.position.y + bounds.size.y + halfSize};
+            for (int axis = 0; axis < 2 && overlaps; ++axis) {
+                if (step[axis] == 0.f) {
+                    overlaps = start[axis] > min[axis] && start[axis] < max[axis];
+                    continue;
+                }
+                float t0 = (min[axis] - start[axis]) / step[axis];
+                float t1 = (max[axis] - start[axis]) / step[axis];
+                enter = std::max(enter, std::min(t0, t1));
+                exit = std::min(exit, std::max(t0, t1));
+                overlaps = enter < exit;
+            }
+            if (overlaps && enter < hit.time) {
+                hit.target = unit;
+                hit.time = enter;
+            }
+        }
+        return hit;
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int ticks = argc > 1 ? std::atoi(argv[1]) : 300;
+    int projectileCount = argc > 2 ? std::atoi(argv[2]) : 10000;
+    int unitCount = argc > 3 ? std::atoi(argv[3]) : 2000;
+    int radius = argc > 4 ? std::atoi(argv[4]) : 40;
+    float speedScale = argc > 5 ? static_cast<float>(std::atof(argv[5])) : 1.f;
+    if (ticks <= 0 || projectileCount <= 0 || unitCount <= 0 || radius <= 0 || speedScale <= 0.f
+        || projectileCount > static_cast<int>(ProjectilePool::CAPACITY)) {
+        std::cerr << "Usage: collision_bench [ticks] [projectiles <= " << ProjectilePool::CAPACITY
+                  << "] [units] [grid radius] [speed scale]" << std::endl;
+        return 1;
+    }
+
+    HexGrid grid(radius, 12345u);
+    if (unitCount > grid.getTileCount()) {
+        std::cerr << "Grid radius " << radius << " only has " << grid.getTileCount() << " tiles" << std::endl;
+        return 1;
+    }
+    sf::FloatRect area = grid.getBounds();
+    std::mt19937 random(12345u);
+
+    // One unit per tile, like the game, alternating sides
+    std::vector<int> tiles(grid.getTileCount());
+    for (int i = 0; i < grid.getTileCount(); ++i) tiles[i] = i;
+    std::shuffle(tiles.begin(), tiles.end(), random);
+    std::vector<sf::FloatRect> units;
+    std::vector<Allegiance> unitAllegiance;
+    for (int i = 0; i < unitCount; ++i) {
+        sf::Vector2f center = grid.getTile(tiles[i])->getPosition();
+        units.push_back(sf::FloatRect(center - sf::Vector2f(UNIT_SIZE, UNIT_SIZE) / 2.f, {UNIT_SIZE, UNIT_SIZE}));
+        unitAllegiance.push_back(i % 2 ? Allegiance::ENEMY : Allegiance::FRIENDLY);
+    }
+
+    std::uniform_real_distribution<float> x(area.position.x, area.position.x + area.size.x);
+    std::uniform_real_distribution<float> y(area.position.y, area.position.y + area.size.y);
+    std::uniform_real_distribution<float> angle(0.f, 6.2831853f);
+    auto fire = [&](ProjectilePool& pool, int n) {
+        ProjectileType type = n % 4 ? ProjectileType::BULLET : ProjectileType::TANK_AMMO;
+        float a = angle(random);
+        pool.spawn({type, {x(random), y(random)}, {std::cos(a), std::sin(a)},
+                    n % 2 ? Allegiance::ENEMY : Allegiance::FRIENDLY});
+    };
+
+    ProjectilePool projectiles;
+    for (int n = 0; n < projectileCount; ++n) fire(projectiles, n);
+
+    CollisionGrid collisionGrid(CELL_SIZE, maxProjectileSize() / 2.f);
+    std::vector<CollisionGrid::Hit> gridHits;
+
+    Clock::duration bruteTime{};
+    Clock::duration buildTime{};
+    Clock::duration gridTime{};
+    std::size_t bruteTests = 0;
+    std::size_t gridTests = 0;
+    std::size_t hits = 0;
+    std::size_t mismatches = 0;
+    std::size_t tunnelled = 0;
+    std::size_t queries = 0;
+
+    for (int tick = 0; tick < ticks; ++tick) {
+        // Scaling the step is the same as scaling every speed
+        projectiles.update(TICK_SECONDS * speedScale);
+        std::size_t count = projectiles.getActiveCount();
+        queries += count;
+
+        // Units are rebucketed every tick, as they are in the game
+        auto buildStart = Clock::now();
+        collisionGrid.begin();
+        for (std::size_t unit = 0; unit < units.size(); ++unit) {
+            collisionGrid.add(units[unit], unitAllegiance[unit]);
+        }
+        collisionGrid.build();
+
+        auto gridStart = Clock::now();
+        gridHits.resize(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            gridHits[i] = collisionGrid.findFirstHit(projectiles.getPreviousPosition(i), projectiles.getPosition(i),
+                                                     projectiles.getHalfSize(i), projectiles.getAllegiance(i));
+        }
+        auto bruteStart = Clock::now();
+        for (std::size_t i = 0; i < count; ++i) {
+            CollisionGrid::Hit hit = findFirstHitBruteForce(projectiles.getPreviousPosition(i), projectiles.getPosition(i),
+                                                            projectiles.getHalfSize(i), projectiles.getAllegiance(i),
+                                                            units, unitAllegiance, bruteTests);
+            // Units touched at exactly the same time may be picked in either order
+            bool hitBrute = hit.target != CollisionGrid::NO_TARGET;
+            bool hitGrid = gridHits[i].target != CollisionGrid::NO_TARGET;
+            if (hitBrute != hitGrid || (hitGrid && hit.time != gridHits[i].time)) mismatches++;
+        }
+        auto bruteEnd = Clock::now();
+
+        buildTime += gridStart - buildStart;
+        gridTime += bruteStart - gridStart;
+        bruteTime += bruteEnd - bruteStart;
+        gridTests += collisionGrid.getTestCount();
+
+        // Units stay up so the load stays constant; spent and expired
+        // projectiles are replaced with fresh ones
+        for (std::size_t i = count; i-- > 0;) {
+            std::uint32_t target = gridHits[i].target;
+            if (target != CollisionGrid::NO_TARGET) {
+                bool endOverlaps = boxAt(projectiles.getPosition(i), projectiles.getHalfSize(i))
+                                       .findIntersection(units[target]).has_value();
+                if (!endOverlaps) tunnelled++;
+                projectiles.kill(i);
+                hits++;
+            }
+        }
+        for (int n = static_cast<int>(projectiles.getActiveCount()); n < projectileCount; ++n) fire(projectiles, n);
+    }
+
+    double n = static_cast<double>(ticks);
+    double q = static_cast<double>(queries);
+    auto micros = [n](Clock::duration d) {
+        return std::chrono::duration<double, std::micro>(d).count() / n;
+    };
+
+    std::cout << "Ticks:                 " << ticks << " (" << projectileCount << " projectiles, "
+              << unitCount << " units, grid radius " << radius << ", speed x" << speedScale << ")" << std::endl;
+    std::cout << "Hits:                  " << hits << " (" << tunnelled
+              << " missed by an end-of-step overlap test)" << std::endl;
+    std::cout << "Brute force:           " << micros(bruteTime) << " us/tick, "
+              << bruteTests / q << " sweep tests/projectile" << std::endl;
+    std::cout << "Collision grid build:  " << micros(buildTime) << " us/tick" << std::endl;
+    std::cout << "Collision grid query:  " << micros(gridTime) << " us/tick, "
+              << gridTests / q << " sweep tests/projectile" << std::endl;
+    std::cout << "Mismatched hits:       " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
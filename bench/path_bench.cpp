@@ -0,0 +1,116 @@
+// Headless move-order planning benchmark.
+//
+// Generates a map and plans routes between random far-apart tiles the ways
+// a move order can be planned: plain A* over tiles, A* with the landmark
+// heuristic, and waypoints over the HPA* cluster graph. Reports the time and
+// expansions per query, and checks that landmarks never change a route's cost.
+//
+// Usage: path_bench [queries] [grid radius] [terrain seed] [min distance]
+
+#include "../include/graphics/HexGrid.h"
+#include "../include/characters/MovementClass.h"
+#include "../include/pathfinding/NavigationGrid.h"
+#include "../include/pathfinding/Pathfinder.h"
+#include "../include/pathfinding/LandmarkTable.h"
+#include "../include/pathfinding/HierarchicalPathfinder.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+}
+
+int main(int argc, char* argv[]) {
+    int queries = argc > 1 ? std::atoi(argv[1]) : 500;
+    int radius = argc > 2 ? std::atoi(argv[2]) : 60;
+    unsigned int seed = argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : 12345u;
+    int minDistance = argc > 4 ? std::atoi(argv[4]) : radius;
+    if (queries <= 0 || radius <= 0 || minDistance < 0 || minDistance > 2 * radius) {
+        std::cerr << "Usage: path_bench [queries] [grid radius] [terrain seed] [min distance <= 2 * radius]" << std::endl;
+        return 1;
+    }
+
+    HexGrid hexes(radius, seed);
+    NavigationGrid grid(hexes);
+    const MovementCosts& costs = movementCostsOf(MovementClass::Infantry);
+
+    auto buildStart = Clock::now();
+    LandmarkTable landmarks(costs);
+    landmarks.build(grid);
+    auto landmarkEnd = Clock::now();
+    HierarchicalPathfinder hierarchy(costs);
+    hierarchy.build(grid);
+    auto hierarchyEnd = Clock::now();
+
+    // Far-apart passable pairs, the long orders the planners are for
+    std::mt19937 random(seed);
+    std::vector<std::pair<int, int>> pairs;
+    while (static_cast<int>(pairs.size()) < queries) {
+        int start = static_cast<int>(random() % grid.getTileCount());
+        int goal = static_cast<int>(random() % grid.getTileCount());
+        if (grid.distance(start, goal) >= minDistance && costs.canEnter(grid.getTerrain(start))
+            && costs.canEnter(grid.getTerrain(goal))) {
+            pairs.emplace_back(start, goal);
+        }
+    }
+
+    Pathfinder pathfinder;
+    HierarchicalPathfinder::Query query;
+    std::vector<int> path;
+    Clock::duration plainTime{};
+    Clock::duration landmarkTime{};
+    Clock::duration hierarchyTime{};
+    long plainNodes = 0;
+    long landmarkNodes = 0;
+    long hierarchyNodes = 0;
+    long distance = 0;
+    int found = 0;
+    int mismatches = 0;
+
+    for (const auto& [start, goal] : pairs) {
+        distance += grid.distance(start, goal);
+
+        auto plainStart = Clock::now();
+        bool plainFound = pathfinder.findPath(grid, start, goal, costs, Allegiance::FRIENDLY, path);
+        auto landmarkStart = Clock::now();
+        int plainCost = pathfinder.getPathCost();
+        plainNodes += pathfinder.getNodesExpanded();
+
+        bool landmarkFound = pathfinder.findPath(grid, start, goal, costs, Allegiance::FRIENDLY, path, &landmarks);
+        auto hierarchyStart = Clock::now();
+        landmarkNodes += pathfinder.getNodesExpanded();
+
+        hierarchy.findWaypoints(grid, start, goal, path, query);
+        auto hierarchyEnd = Clock::now();
+        hierarchyNodes += query.nodesExpanded;
+
+        plainTime += landmarkStart - plainStart;
+        landmarkTime += hierarchyStart - landmarkStart;
+        hierarchyTime += hierarchyEnd - hierarchyStart;
+        found += plainFound;
+        if (plainFound != landmarkFound || (plainFound && plainCost != pathfinder.getPathCost())) {
+            mismatches++;
+        }
+    }
+
+    double n = static_cast<double>(queries);
+    auto micros = [](Clock::duration d) { return std::chrono::duration<double, std::micro>(d).count(); };
+
+    std::cout << "Queries:               " << queries << " (grid radius " << radius << ", "
+              << grid.getTileCount() << " tiles, mean distance " << distance / n << ", " << found
+              << " reachable)" << std::endl;
+    std::cout << "Landmark build:        " << micros(landmarkEnd - buildStart) / 1000.0 << " ms" << std::endl;
+    std::cout << "Cluster graph build:   " << micros(hierarchyEnd - landmarkEnd) / 1000.0 << " ms" << std::endl;
+    std::cout << "A*:                    " << micros(plainTime) / n << " us/query, "
+              << plainNodes / n << " tiles expanded" << std::endl;
+    std::cout << "A* with landmarks:     " << micros(landmarkTime) / n << " us/query, "
+              << landmarkNodes / n << " tiles expanded" << std::endl;
+    std::cout << "HPA* waypoints:        " << micros(hierarchyTime) / n << " us/query, "
+              << hierarchyNodes / n << " nodes expanded" << std::endl;
+    std::cout << "Cost mismatches:       " << mismatches << std::endl;
+
+    return mismatches == 0 ? 0 : 1;
+}
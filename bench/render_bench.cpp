@@ -0,0 +1,154 @@
+// Headless render benchmark.
+//
+// Builds a world, pans the camera across it and renders every frame into a
+// RecordingRenderBackend. Textures are disabled, so it runs without a window
+// or GPU: units draw as flat stand-in quads and the HUD has no text. Reports
+// draw calls, vertices, texture/state switches per frame and the CPU cost of
+// capturing and rendering a frame. Since every sprite is untextured, the
+// texture switch count does not reflect the game's sprite batching.
+//
+// Usage: render_bench [frames] [grid radius] [terrain seed]
+
+#include "../include/graphics/HexGrid.h"
+#include "../include/graphics/GridFiller.h"
+#include "../include/graphics/VisibilitySystem.h"
+#include "../include/graphics/SceneCapture.h"
+#include "../include/graphics/SideBar.h"
+#include "../include/graphics/StatusOverlay.h"
+#include "../include/graphics/Renderer.h"
+#include "../include/graphics/RecordingRenderBackend.h"
+#include "../include/graphics/TextureManager.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+    int frames = argc > 1 ? std::atoi(argv[1]) : 600;
+    int radius = argc > 2 ? std::atoi(argv[2]) : 20;
+    unsigned int seed = argc > 3 ? static_cast<unsigned int>(std::atoi(argv[3])) : 12345u;
+    if (frames <= 0 || radius <= 0) {
+        std::cerr << "Usage: render_bench [frames] [grid radius] [terrain seed]" << std::endl;
+        return 1;
+    }
+
+    // Nothing below may create a texture
+    TextureManager::getInstance().setTexturesEnabled(false);
+
+    // There is no world save format, so regenerate the world from a fixed
+    // terrain seed. Entity placement still uses its own randomness.
+    std::srand(seed);
+    HexGrid grid(radius, seed);
+    GridFiller gridFiller(grid);
+    gridFiller.fillGrid();
+    auto cities = gridFiller.getCities();
+    auto resources = gridFiller.getResources();
+    auto buildings = gridFiller.getBuildings();
+    auto characters = gridFiller.getCharacters();
+
+    // Same visibility pass as Game::update
+    std::vector<Character*> characterPtrs;
+    for (const auto& character : characters) characterPtrs.push_back(character.get());
+    VisibilitySystem visibility;
+    for (const auto& building : buildings) {
+        visibility.addStaticObserver(building->getId(), building->getAllegiance(),
+                                     grid.getTileIndex(grid.pixelToCube(building->getPosition())),
+                                     building->getVisibilityRange());
+    }
+    for (const auto& city : cities) {
+        visibility.addStaticObserver(city->getId(), city->getAllegiance(),
+                                     grid.getTileIndex(grid.pixelToCube(city->getPosition())),
+                                     VisibilitySystem::CITY_VISIBILITY_RANGE);
+    }
+    visibility.updateVisibility(grid, characterPtrs);
+
+    // Every building with its tile, found once like Game's building registry
+    std::vector<std::pair<const Building*, int>> buildingTiles;
+    for (int index = 0; index < grid.getTileCount(); ++index) {
+        if (grid.getTile(index)->hasBuilding()) {
+            buildingTiles.push_back({grid.getTile(index)->getBuilding(), index});
+        }
+    }
+    for (const auto& building : buildings) {
+        bool onHex = std::any_of(buildingTiles.begin(), buildingTiles.end(),
+                                 [&](const auto& entry) { return entry.first == building.get(); });
+        if (!onHex) {
+            buildingTiles.push_back({building.get(), grid.getTileIndex(grid.pixelToCube(building->getPosition()))});
+        }
+    }
+
+    const sf::Vector2u windowSize(1200, 800);
+    RecordingRenderBackend backend(windowSize);
+    Renderer renderer(backend);
+    SideBar sideBar(sf::Vector2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y)));
+
+    StatusOverlay statusOverlay;
+    RenderSnapshot snapshot;
+    sf::FloatRect bounds = grid.getBounds();
+    sf::Vector2f center = bounds.position + bounds.size / 2.f;
+    sf::Vector2f sweep = bounds.size / 3.f;
+
+    using Clock = std::chrono::steady_clock;
+    Clock::duration captureTime{};
+    Clock::duration renderTime{};
+
+    for (int frame = 0; frame < frames; ++frame) {
+        // Pan the camera in a slow ellipse over the world
+        float t = static_cast<float>(frame) / static_cast<float>(frames) * 6.2831853f;
+        sf::Vector2f cameraCenter(center.x + std::cos(t) * sweep.x, center.y + std::sin(t) * sweep.y);
+
+        auto captureStart = Clock::now();
+        snapshot.clear();
+        snapshot.frame = static_cast<std::uint64_t>(frame);
+        snapshot.camera = sf::View(cameraCenter, sf::Vector2f(static_cast<float>(windowSize.x), static_cast<float>(windowSize.y)));
+        snapshot.fogOfWarEnabled = true;
+        SceneCapture::captureGrid(snapshot, grid, visibility);
+        for (const auto& character : characters) {
+            SceneCapture::captureCharacter(snapshot, grid, *character);
+        }
+
+        // Same pass as Game::updateStatusOverlay
+        statusOverlay.beginFrame();
+        auto isTileVisible = [&grid](int tile) { return tile >= 0 && grid.getTile(tile)->isVisible(); };
+        for (const auto& [building, tile] : buildingTiles) {
+            statusOverlay.updateBuilding(*building, isTileVisible(tile));
+        }
+        for (const auto& character : characters) {
+            statusOverlay.updateCharacter(*character, isTileVisible(grid.getTileIndex(character->getHexCoord())));
+        }
+        statusOverlay.endFrame();
+        if (snapshot.statusBarsRevision != statusOverlay.getRevision()) {
+            snapshot.statusBars = statusOverlay.getVertices();
+            snapshot.statusBarsRevision = statusOverlay.getRevision();
+        }
+
+        sideBar.captureRenderState(snapshot.interfaceRects);
+        snapshot.interfaceRevision = sideBar.getRevision();
+        auto renderStart = Clock::now();
+
+        renderer.render(snapshot);
+        renderer.display();
+        auto renderEnd = Clock::now();
+
+        captureTime += renderStart - captureStart;
+        renderTime += renderEnd - renderStart;
+    }
+
+    RenderFrameStats totals = backend.getTotals();
+    double n = static_cast<double>(frames);
+    auto micros = [n](Clock::duration d) {
+        return std::chrono::duration<double, std::micro>(d).count() / n;
+    };
+
+    std::cout << "Frames:                " << frames << " (grid radius " << radius << ", seed " << seed << ")" << std::endl;
+    std::cout << "Draw calls / frame:    " << totals.drawCalls / n << std::endl;
+    std::cout << "Vertices / frame:      " << totals.vertices / n << std::endl;
+    std::cout << "Texture switches / fr: " << totals.textureSwitches / n << std::endl;
+    std::cout << "State changes / frame: " << totals.stateChanges / n << std::endl;
+    std::cout << "Capture us / frame:    " << micros(captureTime) << std::endl;
+    std::cout << "Render us / frame:     " << micros(renderTime) << std::endl;
+    return 0;
+}
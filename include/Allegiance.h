@@ -1,6 +1,8 @@
 #ifndef ALLEGIANCE_H
 #define ALLEGIANCE_H
 
+#include <cstdint>
+
 // Enum to distinguish between player-controlled (friendly) and enemy entities
 enum class Allegiance {
     FRIENDLY,  // Player-controlled
@@ -8,4 +10,12 @@ enum class Allegiance {
     NEUTRAL    // Not affiliated with either side
 };
 
+// Number of allegiances, for per-faction tables
+constexpr int FACTION_COUNT = 3;
+
+// One bit per allegiance, for per-faction bitmasks
+constexpr std::uint8_t factionBit(Allegiance allegiance) {
+    return static_cast<std::uint8_t>(1u << static_cast<int>(allegiance));
+}
+
 #endif // ALLEGIANCE_H 
\ No newline at end of file
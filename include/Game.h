@@ -8,6 +8,13 @@
 #include "graphics/HexGrid.h"
 #include "InputHandler.h"
 #include "graphics/Renderer.h"
+#include "graphics/RenderThread.h"
+#include "graphics/RenderBackend.h"
+#include "graphics/SceneCapture.h"
+#include "graphics/FrameBudgetGovernor.h"
+#include "graphics/StatusOverlay.h"
+#include "graphics/ParticleSystem.h"
+#include "graphics/TileOverlay.h"
 #include "characters/Soldier.h"
 #include "buildings/City.h"
 #include "buildings/Building.h"
@@ -17,8 +24,20 @@
 #include "economy/InternationalMarkets.h"
 #include "economy/Government.h"
 #include "graphics/SideBar.h"
-#include "projectiles/Projectile.h"
+#include "projectiles/ProjectilePool.h"
+#include "projectiles/CollisionGrid.h"
+#include "pathfinding/NavigationGrid.h"
+#include "pathfinding/Pathfinder.h"
+#include "pathfinding/CooperativePathfinder.h"
+#include "pathfinding/ReservationTable.h"
+#include "pathfinding/FlowField.h"
+#include "pathfinding/HierarchicalPathfinder.h"
+#include "pathfinding/PathCache.h"
+#include "pathfinding/LandmarkTable.h"
+#include "pathfinding/PathRequestService.h"
+#include "pathfinding/MovementRange.h"
 #include <list>
+#include <unordered_map>
 
 class Game {
 public:
@@ -36,10 +55,63 @@ public:
     void onLeftClick(const sf::Vector2f& worldPos);
     void onRightClick(const sf::Vector2f& worldPos);
     void onKeyPress(sf::Keyboard::Key key);
-    void moveSelectedCharacter(Hexagon* source, Hexagon* target, Character* character);
+    void onClose();
+    
+    // Camera used to map mouse input to world coordinates
+    const sf::View& getCamera() const { return mCamera; }
+    
+    // Move a character one tile; returns false if the move isn't allowed
+    bool moveSelectedCharacter(Hexagon* source, Hexagon* target, Character* character);
     Hexagon* getSourceHex(Character* character);
 
 private:
+    // Fixed simulation rate; rendering runs independently on the render thread
+    static constexpr float TICK_SECONDS = 1.0f / 60.0f;
+    
+    // Time a unit following a move order spends on each tile. Every order
+    // steps together on this clock, which is what reservations are made in.
+    static constexpr float MOVE_STEP_SECONDS = 0.25f;
+    
+    // Goals at least this far away are routed through the cluster graph first
+    static constexpr int HIERARCHICAL_MIN_DISTANCE = 2 * HierarchicalPathfinder::CLUSTER_SIZE;
+    
+    // Nearer goals get a whole route from plain A*, cut into legs of this many
+    // tiles so each space-time search reaches its waypoint well inside its window
+    static constexpr int ROUTE_LEG_TILES = CooperativePathfinder::WINDOW / 2;
+    
+    // Time each tick may spend applying routes solved by the path workers
+    static constexpr float ROUTE_APPLY_BUDGET_SECONDS = 0.002f;
+    
+    // Edge of a projectile collision cell, about one hex across
+    static constexpr float COLLISION_CELL_SIZE = 50.0f;
+    
+    // What a collision grid target stands for; exactly one of the two is set
+    struct CollisionTarget {
+        Building* building;
+        Character* character;
+    };
+    
+    // A path being walked, one entry per move step. Long orders are a list
+    // of waypoints, and the path to the next one is only planned when the
+    // previous one is reached. Paths are planned cooperatively, a window of
+    // steps at a time, and reserved so other units plan around them. Group
+    // orders are guided by a shared flow field to the goal.
+    struct MoveOrder {
+        std::vector<int> waypoints; // Tile indices, ending with the goal
+        std::size_t nextWaypoint = 0;
+        bool awaitingRoute = false; // Waypoints are still being solved off the tick
+        std::vector<int> path;      // Tile for each step, waits repeating the tile
+        std::size_t next = 0;       // Next entry of path to step onto
+        std::uint64_t pathStep = 0; // Move step of path[0]
+        int origin = -1;            // Tile the path starts from, held the step before
+        bool replanned = false;     // Already replanned once around a blocked step
+        
+        bool followField = false;
+        int goal = -1;
+        MovementCosts costs;
+        std::uint32_t fieldCost = 0; // Field cost where the current window started
+    };
+    
     sf::RenderWindow mWindow;
     sf::Clock mClock;
     float mDeltaTime;
@@ -49,7 +121,26 @@ private:
     sf::FloatRect mGridBounds; // Boundaries of the hex grid
     
     InputHandler mInputHandler;
+    WindowRenderBackend mRenderBackend;
     Renderer mRenderer;
+    RenderThread mRenderThread;
+    FrameBudgetGovernor mFrameGovernor;
+    
+    // Tick counter, used to spread throttled work across ticks
+    std::uint64_t mTick = 0;
+    
+    // Impact and explosion effects
+    ParticleSystem mParticles;
+    
+    // Health, defense and cooldown bars, updated incrementally every frame
+    StatusOverlay mStatusOverlay;
+    
+    // Movement range of the selected unit, rebuilt only when the selection changes
+    TileOverlay mRangeOverlay;
+    MovementRange mMovementRange;
+    
+    // Last government data sent to the HUD, refreshed at the governor's interval
+    HudData mHudData;
     VisibilitySystem mVisibilitySystem;
     
     HexGrid mGrid;
@@ -74,43 +165,96 @@ private:
     
     // Store standalone buildings (like oil refineries) with proper ownership (using list for stable memory addresses)
     std::list<std::unique_ptr<Building>> mBuildings;
+    
+    // Every building on the map, owned by a city or by mBuildings, registered
+    // once when it is placed so nothing has to scan the grid for them
+    std::vector<Building*> mBuildingRegistry;
+    std::vector<int> mBuildingTiles;    // Tile of each registry entry, -1 if off the grid
 
-    // Using list for projectiles to maintain stable memory addresses
-    std::list<std::unique_ptr<Projectile>> mProjectiles;
+    // Projectiles in flight, as plain values in fixed-capacity storage
+    ProjectilePool mProjectiles;
+    
+    // Buildings and characters bucketed for projectile hits, rebuilt every
+    // tick; mCollisionTargets is indexed by collision grid target
+    CollisionGrid mCollisionGrid{COLLISION_CELL_SIZE, maxProjectileSize() / 2.0f};
+    std::vector<CollisionTarget> mCollisionTargets;
     
     // Toggle for fog of war
     bool mFogOfWarEnabled = true;
     
-    // UI elements for government data
-    sf::Font mFont;
-    std::optional<sf::Text> mGovDataText;
+    // Grid line style, sent to the renderer with every snapshot
+    GridOutlineStyle mGridOutline;
     
     // Sidebar for UI controls
     SideBar mSideBar;
     
+    // Terrain and occupancy for pathfinding, kept in sync with the grid
+    NavigationGrid mNavigation;
+    CooperativePathfinder mPathfinder;
+    Pathfinder mRoutePlanner;           // Whole routes for single move orders
+    std::vector<int> mRoute;            // Last route from mRoutePlanner, reused
+    FlowFieldCache mFlowFields;
+    
+    // Tiles claimed by moving units for the coming move steps
+    ReservationTable mReservations;
+    std::uint64_t mMoveStep = 0;
+    float mMoveClock = 0.f;
+    
+    // Cluster graphs for long routes, one per set of movement costs in play
+    std::vector<std::unique_ptr<HierarchicalPathfinder>> mHierarchies;
+    
+    // Landmark heuristics, built at load for every set of movement costs in play
+    std::vector<std::unique_ptr<LandmarkTable>> mLandmarks;
+    
+    // Waypoints of long routes already planned, shared by units starting near each other
+    PathCache mPathCache;
+    
+    // Long routes solved on worker threads; declared after everything the
+    // workers read so it stops them first
+    PathRequestService mPathRequests;
+    
+    // Move orders in progress, by character id
+    std::unordered_map<std::uint32_t, MoveOrder> mMoveOrders;
+    std::vector<Character*> mStepping;  // Units still to take the current move step, reused
+    
     void update();
+    
+    // Capture the current frame into a render snapshot and hand it to the render thread
     void render();
+    
+    // Refresh the status bars of everything standing on the grid
+    void updateStatusOverlay();
+    
+    // Spawn the effect for a projectile hitting something at position, unless
+    // fog of war hides it. The type is the one the pool stored at spawn.
+    void emitImpact(ProjectileType type, const sf::Vector2f& position, bool hitBuilding);
     void updateCamera(const sf::Vector2f& movement);
     void highlightAxis(HighlightAxis axis);
     
-    // Render government data on screen
-    void renderGovernmentData();
-    
     void generateCityHexesPositions();
     // Clamp camera position to ensure it stays within grid bounds
     sf::Vector2f clampCameraPosition(const sf::Vector2f& position);
     
-    // Update visibility based on game entities
+    // Resync all visibility observers with the game entities
     void updateVisibility();
     
     // Helper to toggle fog of war on/off
     void toggleFogOfWar();
     
+    // Show or hide the grid lines
+    void toggleGridOutlines();
+    
     // Get all characters for visibility calculations
     std::vector<Character*> getCharacters() const;
     
-    // Get all buildings for visibility calculations
-    std::vector<Building*> getBuildings() const;
+    // Get all buildings on the map
+    const std::vector<Building*>& getBuildings() const { return mBuildingRegistry; }
+    
+    // Add a building to the registry and make it a static visibility observer.
+    // Call when a building is built, and unregisterBuilding when it is destroyed;
+    // that also clears its hex. checkCollisions does so at 0 health.
+    void registerBuilding(Building* building, const Hexagon::CubeCoord& coord);
+    void unregisterBuilding(Building* building);
 
     void generateProducts();
     NationalAccounts mNationalAccounts;
@@ -121,11 +265,51 @@ private:
     void handleSideBarClick(SideBar::CellId cell);
 
     void setCharactersTargetPosition();
+    
+    // Pick a character's target: an adjacent enemy unit, else the closest
+    // enemy unit in range (tracked only), else the closest enemy building
+    void findTarget(Character& character);
+    
+    // Plan a path for a character to a tile and start walking it
+    bool orderMove(Character* character, Hexagon* target);
+    
+    // Plan the path to the next waypoint that can be reached and reserve it
+    bool planSegment(Character* character, MoveOrder& order);
+    
+    // Plan the next move of a group order: one step down its flow field, or a
+    // space-time window around the units in the way when that step is taken
+    bool planFieldWindow(Character* character, MoveOrder& order);
+    
+    // Claim, or give back, the steps of an order's path not yet walked. A
+    // claim that fails holds nothing and returns false.
+    bool reservePath(std::uint32_t id, const MoveOrder& order);
+    void releasePath(std::uint32_t id, const MoveOrder& order);
+    
+    // Stop a move order, freeing its reservations
+    void cancelMoveOrder(std::uint32_t id);
+    
+    // Take a route back from the path workers: cache it, and start the order waiting for it
+    void applyRoute(const PathResult& result);
+    
+    // Cluster graph for a set of movement costs, built on first use
+    HierarchicalPathfinder& getHierarchy(const MovementCosts& costs);
+    
+    // Landmarks for a set of movement costs, or nullptr if none were built
+    const LandmarkTable* findLandmarks(const MovementCosts& costs) const;
+    
+    // Send every friendly unit to a tile along shared flow fields
+    void orderGroupMove(Hexagon* target);
+    
+    // Advance the move clock, stepping every move order when it ticks over
+    void updateMoveOrders();
 
     void moveProjectiles();
+    
+    // Bucket every building and character for this tick's projectile hits
+    void buildCollisionGrid();
 
     // Check collisions and return true if the projectile should be removed
-    bool checkCollisions(Projectile* projectile);
+    bool checkCollisions(std::size_t projectile);
 };
 
 #endif // GAME_H 
\ No newline at end of file
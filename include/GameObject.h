@@ -2,10 +2,12 @@
 #define GAME_OBJECT_H
 
 #include <SFML/Graphics.hpp>
+#include <cstdint>
 #include <memory>
 #include <iostream>
 #include "Allegiance.h"
 #include "graphics/TextureManager.h"
+#include "graphics/RenderSnapshot.h"
 
 class GameObject {
 public:
@@ -24,6 +26,12 @@ public:
     virtual void setPosition(const sf::Vector2f& position);
     sf::Vector2f getPosition() const;
     
+    // Unique id, stable for the object's lifetime (survives moves)
+    std::uint32_t getId() const { return mId; }
+    
+    // Hand out a new id; shared with other entities (cities) so ids never collide
+    static std::uint32_t allocateId() { return sNextId++; }
+    
     // Allegiance methods
     Allegiance getAllegiance() const { return mAllegiance; }
     void setAllegiance(Allegiance allegiance) { mAllegiance = allegiance; }
@@ -33,6 +41,9 @@ public:
     // Rendering
     virtual void render(sf::RenderWindow& window) const;
     
+    // Append this object's draw commands to a render snapshot
+    void captureRenderState(std::vector<SpriteCommand>& sprites, RenderLayer layer) const;
+    
     // Graphics methods
     bool loadTexture(const std::string& path);
     void createShape(sf::Color color, bool isCircle = true);
@@ -57,6 +68,10 @@ public:
     bool collidesWith(const GameObject& other) const;
     
 protected:
+    // Identity
+    std::uint32_t mId;
+    static std::uint32_t sNextId;
+    
     // Position data
     float mXPos;
     float mYPos;
@@ -66,6 +81,7 @@ protected:
     
     // NVI pattern for rendering
     virtual void doRender(sf::RenderWindow& window) const;
+    virtual void doCaptureRenderState(std::vector<SpriteCommand>& sprites, RenderLayer layer) const;
     
     // Graphics members
     sf::Image mImage;
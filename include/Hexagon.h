@@ -6,6 +6,7 @@
 #include <optional>
 #include <memory>
 #include "buildings/Building.h"
+#include "Allegiance.h"
 
 // Forward declarations
 class Character;
@@ -19,6 +20,9 @@ enum class TerrainType {
     URBAN
 };
 
+// Number of TerrainType values, for per-terrain tables
+constexpr int TERRAIN_TYPE_COUNT = 4;
+
 class Hexagon {
 public:
     // Cube coordinates (q, r, s)
@@ -80,6 +84,12 @@ public:
     
     sf::Vector2f getPosition() const;
     
+    // Current fill color, including any highlight
+    sf::Color getFillColor() const { return mShape.getFillColor(); }
+    
+    // Permanent color, without highlights
+    sf::Color getBaseColor() const { return color; }
+    
     CubeCoord getCoord() const;
     void draw(sf::RenderWindow& window) const;
     
@@ -90,6 +100,10 @@ public:
     // Get neighbor in a given direction
     static CubeCoord neighbor(const CubeCoord& cube, int direction);
     
+    // Direction (index into directions) of the neighbor across an edge.
+    // Edge i runs from corner i to corner i + 1 of the pointy-top shape.
+    static int edgeDirection(int edge) { return (edge + 2) % 6; }
+    
     // Calculate distance between two hexes
     static int distance(const CubeCoord& a, const CubeCoord& b);
     void setColor(const sf::Color& color);
@@ -102,18 +116,44 @@ public:
     void highlight(const sf::Color& color);
     void removeHighlight();
     
-    // Visibility methods
-    bool isVisible() const { return mIsVisible; }
-    void setVisible(bool visible) { mIsVisible = visible; }
-    
-    bool isExplored() const { return mIsExplored; }
-    void setExplored(bool explored) { mIsExplored = explored; }
+    // Visibility methods; isVisible()/setVisible() are the player's (FRIENDLY) view
+    bool isVisible() const { return isVisibleTo(Allegiance::FRIENDLY); }
+    void setVisible(bool visible) { setVisibleTo(Allegiance::FRIENDLY, visible); }
+    
+    // Per-faction visibility, one bit per allegiance
+    bool isVisibleTo(Allegiance allegiance) const { return mVisibleFactions & factionBit(allegiance); }
+    void setVisibleTo(Allegiance allegiance, bool visible) {
+        if (visible) {
+            mVisibleFactions |= factionBit(allegiance);
+        } else {
+            mVisibleFactions &= ~factionBit(allegiance);
+        }
+    }
+    std::uint8_t getVisibleFactions() const { return mVisibleFactions; }
+    void clearVisibility() { mVisibleFactions = 0; }
+    
+    // Explored state, persistent once set; isExplored()/setExplored() are the player's
+    bool isExplored() const { return isExploredBy(Allegiance::FRIENDLY); }
+    void setExplored(bool explored) { setExploredBy(Allegiance::FRIENDLY, explored); }
+    bool isExploredBy(Allegiance allegiance) const { return mExploredFactions & factionBit(allegiance); }
+    void setExploredBy(Allegiance allegiance, bool explored) {
+        if (explored) {
+            mExploredFactions |= factionBit(allegiance);
+        } else {
+            mExploredFactions &= ~factionBit(allegiance);
+        }
+    }
     
     TerrainType getTerrainType() const { return mTerrainType; }
     void setTerrainType(TerrainType type) { mTerrainType = type; }
     
+    // Dense index of this hex in its HexGrid
+    int getIndex() const { return mIndex; }
+    void setIndex(int index) { mIndex = index; }
+    
 private:
     CubeCoord mCoord;
+    int mIndex = -1;
     sf::ConvexShape mShape;
     static constexpr float SIZE = 25.0f; // Smaller size for a better fit
     
@@ -127,8 +167,8 @@ private:
     sf::Color highlightColor;   // Current highlight color if any
     TerrainType mTerrainType;
     // Visibility state
-    bool mIsVisible = false;    // Currently visible
-    bool mIsExplored = false;   // Has been seen before
+    std::uint8_t mVisibleFactions = 0;  // Bit per allegiance currently seeing this hex
+    std::uint8_t mExploredFactions = 0; // Bit per allegiance that has seen this hex before
     
     void createHexagonShape();
 
@@ -54,6 +54,7 @@ class Building : public GameObject {
         
         // Override render implementation
         void doRender(sf::RenderWindow& window) const override;
+        void doCaptureRenderState(std::vector<SpriteCommand>& sprites, RenderLayer layer) const override;
         
         // Rectangle shape for non-textured shapes
         sf::RectangleShape mShape;
@@ -2,6 +2,7 @@
 #define CITY_H
 
 #include "../graphics/HexGrid.h"
+#include <cstdint>
 #include <vector>
 #include <map>
 #include <string>
@@ -29,6 +30,9 @@ class City {
             return cityHexes.empty() ? sf::Vector2f(0, 0) : cityHexes[0]->getPosition();
         }
         
+        // Unique id, from the same pool as GameObject ids
+        std::uint32_t getId() const { return mId; }
+        
         // Allegiance accessor
         Allegiance getAllegiance() const { return mAllegiance; }
         
@@ -44,6 +48,7 @@ class City {
         // Use unique_ptr for owned buildings
         std::map<Hexagon::CubeCoord, std::unique_ptr<Building>> buildings;
         Allegiance mAllegiance;
+        std::uint32_t mId;
         //generate buildings
         void generateBuildings();
 };
@@ -6,9 +6,10 @@
 #include <optional>
 #include "Hexagon.h"
 #include "CharacterType.h"
+#include "MovementClass.h"
 #include "Allegiance.h"
 #include "projectiles/ProjectileType.h"
-#include "projectiles/Projectile.h"
+#include "projectiles/ProjectilePool.h"
 #include "GameObject.h"
 
 class Character : public GameObject {
@@ -43,10 +44,18 @@ class Character : public GameObject {
         int getVisibilityRange() const { return mVisibilityRange; }
         void setVisibilityRange(int range) { mVisibilityRange = range; }
         
-        // Target position methods
-        void setTargetPosition(const sf::Vector2f& position) { mTargetPosition = position; }
+        // Line-of-sight vision (blocked by forest and urban tiles) instead of a plain radius
+        bool usesLineOfSight() const { return mLineOfSight; }
+        void setLineOfSight(bool lineOfSight) { mLineOfSight = lineOfSight; }
+        
+        // Target position methods; a target set with fire = false is only tracked
+        void setTargetPosition(const sf::Vector2f& position, bool fire = true) {
+            mTargetPosition = position;
+            mFireAtTarget = fire;
+        }
         void clearTargetPosition() { mTargetPosition.reset(); }
         bool hasTarget() const { return mTargetPosition.has_value(); }
+        bool firesAtTarget() const { return mTargetPosition.has_value() && mFireAtTarget; }
         sf::Vector2f getTargetPosition() const { 
             return mTargetPosition.value_or(sf::Vector2f(0, 0)); 
         }
@@ -55,9 +64,11 @@ class Character : public GameObject {
         }
         
         int getRange() const { return range; }
-        std::optional<Projectile> shootProjectile();
+        int getSpeed() const { return speed; }
+        std::optional<ProjectileShot> shootProjectile();
         void resetShootCooldown(int cooldownTime = 60);
         int getShootCooldown() const { return shootCooldown; }
+        int getShootCooldownLength() const { return shootCooldownLength; }
         void updateShootCooldown(float deltaTime) { shootCooldown -= deltaTime; }
         bool canShoot() const { return shootCooldown <= 0; }
         void updateCooldowns(float deltaTime);
@@ -65,8 +76,12 @@ class Character : public GameObject {
         
         // Health status methods
         int getHealth() const { return health; }
+        int getMaxHealth() const { return maxHealth; }
         bool isDead() const { return health <= 0; }
-        std::vector<TerrainType> getTraversableTerrain() const { return mTraversableTerrain; }
+        
+        // Terrain this character can cross and what each step costs
+        MovementClass getMovementClass() const { return mMovementClass; }
+        const MovementCosts& getMovementCosts() const { return movementCostsOf(mMovementClass); }
     protected:
         static constexpr float STANDARD_SIZE = 25.0f;
         
@@ -79,7 +94,8 @@ class Character : public GameObject {
         
         std::optional<ProjectileType> mProjectileType;
         std::optional<sf::Vector2f> mTargetPosition;
-        std::vector<TerrainType> mTraversableTerrain;
+        bool mFireAtTarget = false;
+        MovementClass mMovementClass = MovementClass::Infantry;
         
         int mQ;
         int mR;
@@ -93,7 +109,9 @@ class Character : public GameObject {
         
         // Default visibility range - can be overridden by specific character types
         int mVisibilityRange = 3;
+        bool mLineOfSight = true;
         int shootCooldown = 0;
+        int shootCooldownLength = 60;   // Length of the last cooldown, for progress display
         float shootCooldownMax = 500;
 };
 
@@ -0,0 +1,29 @@
+#ifndef MOVEMENT_CLASS_H
+#define MOVEMENT_CLASS_H
+
+#include "../pathfinding/MovementCosts.h"
+#include <array>
+
+// How a kind of unit gets around. Every character has one, and everything
+// that moves units or plans for them reads its costs from the table below.
+enum class MovementClass {
+    Infantry,
+    Tracked
+};
+
+constexpr int MOVEMENT_CLASS_COUNT = 2;
+
+// Indexed by MovementClass
+constexpr std::array<MovementCosts, MOVEMENT_CLASS_COUNT> MOVEMENT_CLASS_COSTS = {
+    // Infantry walks anywhere but water
+    MovementCosts::fromMask(terrainBit(TerrainType::PLAINS) | terrainBit(TerrainType::URBAN)
+                            | terrainBit(TerrainType::FOREST)),
+    // Tracked vehicles keep to open ground and roads
+    MovementCosts::fromMask(terrainBit(TerrainType::PLAINS) | terrainBit(TerrainType::URBAN))
+};
+
+constexpr const MovementCosts& movementCostsOf(MovementClass movementClass) {
+    return MOVEMENT_CLASS_COSTS[static_cast<int>(movementClass)];
+}
+
+#endif // MOVEMENT_CLASS_H
@@ -0,0 +1,58 @@
+#ifndef FRAME_BUDGET_GOVERNOR_H
+#define FRAME_BUDGET_GOVERNOR_H
+
+#include <SFML/System.hpp>
+
+// Watches per-frame update and render cost against a frame budget and trades
+// optional work for frame time. Level 0 is full quality; each higher level
+// turns off one more optional feature. Levels drop quickly when frames run
+// over budget and come back slowly once there is steady headroom.
+class FrameBudgetGovernor {
+public:
+    static constexpr int MAX_QUALITY_LEVEL = 5;
+
+    explicit FrameBudgetGovernor(sf::Time frameBudget);
+
+    // Record the cost of the last simulation update and the last rendered frame
+    void recordUpdateTime(sf::Time time);
+    void recordRenderTime(sf::Time time);
+
+    // Re-evaluate the quality level; call once per tick after recording
+    void endFrame();
+
+    // Current quality level, 0 (full) to MAX_QUALITY_LEVEL; shown on the HUD
+    int getQualityLevel() const { return mQualityLevel; }
+
+    // Smoothed costs as a fraction of the budget, for telemetry
+    float getUpdateLoad() const { return mUpdateLoad; }
+    float getRenderLoad() const { return mRenderLoad; }
+
+    // Optional work, in the order it is given up
+    int getHudRefreshInterval() const { return mQualityLevel >= 1 ? 10 : 1; }
+    bool drawOutlines() const { return mQualityLevel < 2; }
+    bool drawProjectileSprites() const { return mQualityLevel < 3; }
+    bool drawFullFog() const { return mQualityLevel < 4; }
+    int getTargetingInterval() const { return mQualityLevel >= 5 ? 2 : 1; }
+
+private:
+    // Load thresholds as a fraction of the budget
+    static constexpr float OVER_BUDGET = 0.9f;
+    static constexpr float HEADROOM = 0.6f;
+
+    // Consecutive frames needed before changing level
+    static constexpr int FRAMES_TO_DEGRADE = 10;
+    static constexpr int FRAMES_TO_RESTORE = 120;
+
+    // Weight of the newest sample in the moving averages
+    static constexpr float SMOOTHING = 0.1f;
+
+    float mBudgetSeconds;
+    float mUpdateLoad = 0.f;
+    float mRenderLoad = 0.f;
+
+    int mQualityLevel = 0;
+    int mOverBudgetFrames = 0;
+    int mHeadroomFrames = 0;
+};
+
+#endif // FRAME_BUDGET_GOVERNOR_H
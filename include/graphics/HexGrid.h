@@ -2,6 +2,7 @@
 #define HEXGRID_H
 
 #include "Hexagon.h"
+#include <array>
 #include <vector>
 #include <unordered_map>
 #include <functional>
@@ -27,6 +28,9 @@ class HexGrid {
 public:
     HexGrid(int radius);
     
+    // Generate terrain from a fixed seed, for reproducible worlds
+    HexGrid(int radius, unsigned int seed);
+    
     // Draw all visible hexagons
     void draw(sf::RenderWindow& window) const;
     
@@ -41,10 +45,23 @@ public:
     
     // Get the hex at the given coordinates
     Hexagon* getHexAt(const Hexagon::CubeCoord& coord);
+    const Hexagon* getHexAt(const Hexagon::CubeCoord& coord) const;
     
     // Get hex at pixel coordinates
     Hexagon* getHexAtPixel(const sf::Vector2f& pixelPos);
     
+    // Dense tile storage: every hex has an index in [0, getTileCount()),
+    // so per-tile data can live in flat arrays instead of hash maps
+    int getTileCount() const { return static_cast<int>(mTiles.size()); }
+    Hexagon* getTile(int index) { return mTiles[index]; }
+    const Hexagon* getTile(int index) const { return mTiles[index]; }
+    
+    // Index of the tile at a coordinate, or -1 off the grid. Pure arithmetic, no hashing
+    int getTileIndex(const Hexagon::CubeCoord& coord) const;
+    
+    // Index of the neighbor in a direction (see Hexagon::directions), or -1 off the grid
+    int getNeighborIndex(int index, int direction) const { return mNeighbors[index][direction]; }
+    
     // Get all hexagons (for external rendering)
     const std::unordered_map<Hexagon::CubeCoord, std::unique_ptr<Hexagon>>& getHexagons() const;
     
@@ -60,9 +77,6 @@ public:
     // Are two hexes adjacent?
     bool areAdjacent(const Hexagon::CubeCoord& coord1, const Hexagon::CubeCoord& coord2);
 
-    // Highlight adjacent hexes
-    void highlightAdjacentHexes(const Hexagon::CubeCoord& coord, sf::Color colo, std::vector<TerrainType> traversableTerrain);
-    
     // Get all hexes within a certain range of a center hex
     std::vector<Hexagon*> getHexesInRange(const Hexagon::CubeCoord& center, int range);
     
@@ -82,9 +96,13 @@ public:
     
 private:
     std::unordered_map<Hexagon::CubeCoord, std::unique_ptr<Hexagon>> mHexagons;
+    std::vector<Hexagon*> mTiles;                   // Indexed by Hexagon::getIndex()
+    std::vector<std::array<int, 6>> mNeighbors;     // Neighbor indices per tile, -1 off the grid
+    std::vector<int> mColumnStart;                  // Index of the first tile of each q column
     const float mHexSize = 25.0f; // Make this match the SIZE in Hexagon.h
     int mRadius;
-    void generateTerrain();
+    void generateTerrain(unsigned int seed);
+    void buildTileIndex();
 };
 
 #endif // HEXGRID_H 
\ No newline at end of file
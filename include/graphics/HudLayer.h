@@ -0,0 +1,56 @@
+#ifndef HUD_LAYER_H
+#define HUD_LAYER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <optional>
+#include <vector>
+#include "RenderBackend.h"
+#include "RenderSnapshot.h"
+
+// Retained-mode HUD. Panels and text are kept between frames and only
+// rebuilt when their inputs change: panels when the sidebar's revision
+// changes, text when the values it shows change. All panels share a single
+// vertex array, so an unchanged HUD costs one panel draw plus its text.
+// Lives on the render thread, owned by the Renderer.
+class HudLayer {
+public:
+    HudLayer();
+
+    // Screen-space panels; rebuilt only when the revision differs from the last one
+    void setPanels(const std::vector<RectCommand>& rects, std::uint32_t revision);
+
+    // Government data panel; re-laid out only when a value changed
+    void setGovernmentData(const HudData& hud);
+
+    // Rebuild whatever is dirty, then draw
+    void draw(RenderBackend& backend);
+
+private:
+    // A retained text block with its own background panel
+    struct TextWidget {
+        std::optional<sf::Text> text;
+        sf::Color panelColor = sf::Color(0, 0, 0, 140);
+        float panelPadding = 6.f;
+        bool dirty = true;
+    };
+
+    sf::Font mFont;
+
+    // Panels as last received from the snapshot
+    std::vector<RectCommand> mPanels;
+    std::optional<std::uint32_t> mPanelRevision;
+
+    // Government data
+    TextWidget mGovernmentText;
+    std::optional<HudData> mShownHud;   // Values currently laid out in mGovernmentText
+
+    // All panel quads, panels first then text backgrounds
+    std::vector<sf::Vertex> mPanelVertices;
+    bool mPanelsDirty = true;
+
+    void layOutGovernmentText(const HudData& hud);
+    void rebuildPanelVertices();
+};
+
+#endif // HUD_LAYER_H
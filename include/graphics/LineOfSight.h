@@ -0,0 +1,45 @@
+#ifndef LINE_OF_SIGHT_H
+#define LINE_OF_SIGHT_H
+
+#include <cstdint>
+#include <vector>
+
+// Precomputed sight lines for hex line of sight. For a given range, every
+// tile offset in the disk records the tiles its two (slightly nudged) lines
+// from the observer's center cross on the way to it, observer and target
+// excluded. A tile is visible when either line crosses nothing that blocks
+// sight, so a tile straight behind a forest is hidden, while one seen along
+// the edge between a forest and a clearing is not. Opaque tiles are
+// themselves visible and shadow what lies behind.
+//
+// Tables depend only on the range, so they are built once and shared by all
+// observers. Evaluating one is a single pass in distance order that reads
+// each line's tiles until the first blocking one.
+// Not thread safe: build and use them from the simulation thread.
+class LineOfSightTable {
+public:
+    struct Entry {
+        int dq, dr;         // Offset from the observer
+        // The lines' tiles are getLineTiles()[lines[0], lines[1]) and
+        // [lines[2], lines[3]); the second equals the first where both lines
+        // cross the same tiles
+        std::uint32_t lines[4];
+    };
+
+    // Table for a range, built on first use and kept for the program's lifetime
+    static const LineOfSightTable& forRange(int range);
+
+    // Ordered by distance from the observer; entry 0 is the observer's own tile
+    const std::vector<Entry>& getEntries() const { return mEntries; }
+
+    // Entry indices of the tiles along every line, nearest first
+    const std::vector<std::uint32_t>& getLineTiles() const { return mLineTiles; }
+
+private:
+    explicit LineOfSightTable(int range);
+
+    std::vector<Entry> mEntries;
+    std::vector<std::uint32_t> mLineTiles;
+};
+
+#endif // LINE_OF_SIGHT_H
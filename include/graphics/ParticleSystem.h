@@ -0,0 +1,69 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Short-lived impact effects. Particles live in fixed-capacity
+// structure-of-arrays storage allocated once up front, so emitting, updating
+// and capturing never touch the heap. Dead particles are swapped out with the
+// last live one, keeping live particles packed at the front of every array.
+class ParticleSystem {
+public:
+    static constexpr std::size_t CAPACITY = 4096;
+    static constexpr std::size_t VERTICES_PER_PARTICLE = 6;
+
+    ParticleSystem();
+
+    // Emitters
+    void emitBulletHit(const sf::Vector2f& position);
+    void emitExplosion(const sf::Vector2f& position);
+    void emitBuildingDamage(const sf::Vector2f& position);
+
+    // Advance all particles and drop the expired ones
+    void update(float deltaTime);
+
+    // Write one quad per live particle; vertices keeps its capacity between
+    // frames, so this stops allocating once it has seen the peak count
+    void captureRenderState(std::vector<sf::Vertex>& vertices) const;
+
+    std::size_t getActiveCount() const { return mCount; }
+
+private:
+    // How an emitter spawns its burst
+    struct EmitterParams {
+        int count;
+        float minSpeed, maxSpeed;       // World units per second
+        float minLifetime, maxLifetime; // Seconds
+        float minSize, maxSize;         // Quad edge length
+        sf::Color color;
+        sf::Color colorVariation;       // Random +- per channel
+    };
+
+    static const EmitterParams BULLET_HIT;
+    static const EmitterParams EXPLOSION;
+    static const EmitterParams BUILDING_DAMAGE;
+
+    // Fraction of velocity kept per second
+    static constexpr float DRAG = 0.05f;
+
+    // Structure of arrays, CAPACITY entries each, [0, mCount) live
+    std::vector<float> mPositionX;
+    std::vector<float> mPositionY;
+    std::vector<float> mVelocityX;
+    std::vector<float> mVelocityY;
+    std::vector<float> mLifetime;       // Seconds left
+    std::vector<float> mInvMaxLifetime; // 1 / initial lifetime, for fading
+    std::vector<float> mSize;
+    std::vector<std::uint32_t> mColor;  // Packed RGBA
+    std::size_t mCount = 0;
+
+    std::minstd_rand mRandom;
+
+    void emit(const EmitterParams& params, const sf::Vector2f& position);
+    void kill(std::size_t index);
+};
+
+#endif // PARTICLE_SYSTEM_H
@@ -0,0 +1,81 @@
+#ifndef RECORDING_RENDER_BACKEND_H
+#define RECORDING_RENDER_BACKEND_H
+
+#include "RenderBackend.h"
+#include <vector>
+
+// One recorded submission
+struct DrawRecord {
+    sf::PrimitiveType type;
+    std::size_t vertexCount;
+    const sf::Texture* texture;
+    const sf::Font* font;   // Text only: its glyph page is the font's page for
+    unsigned characterSize; // this size, named here instead of fetched
+    bool textureSwitch;     // Texture differs from the previous draw
+    bool stateChange;       // View or blend mode changed since the previous draw
+};
+
+// Per-frame counters
+struct RenderFrameStats {
+    std::size_t drawCalls = 0;
+    std::size_t vertices = 0;
+    std::size_t textureSwitches = 0;
+    std::size_t stateChanges = 0;
+    std::size_t clears = 0;
+};
+
+// Backend that records what would have been submitted instead of talking to
+// OpenGL, so rendering can be measured on machines without a GPU or window.
+// Vertex data itself is not copied, only counted. Text is recorded without
+// building its geometry, which would rasterize glyphs into a GL texture.
+class RecordingRenderBackend : public RenderBackend {
+public:
+    explicit RecordingRenderBackend(const sf::Vector2u& size);
+
+    void clear(const sf::Color& color) override;
+    void setView(const sf::View& view) override;
+    const sf::View& getDefaultView() const override { return mDefaultView; }
+    sf::Vector2u getSize() const override { return mSize; }
+
+    void draw(const sf::Vertex* vertices, std::size_t vertexCount,
+              sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default) override;
+    void drawText(const sf::Text& text) override;
+
+    // Closes the current frame and starts a new one
+    void display() override;
+
+    // Draws recorded in the last completed frame
+    const std::vector<DrawRecord>& getLastFrameRecords() const { return mLastFrameRecords; }
+
+    // Counters for every completed frame, oldest first
+    const std::vector<RenderFrameStats>& getFrameStats() const { return mFrameStats; }
+
+    // Sum of all completed frames
+    RenderFrameStats getTotals() const;
+
+    // Forget all recorded frames
+    void reset();
+
+private:
+    sf::Vector2u mSize;
+    sf::View mDefaultView;
+
+    // Current state, to detect switches between draws
+    sf::View mView;
+    bool mViewChanged = true;
+    const sf::Texture* mLastTexture = nullptr;
+    const sf::Font* mLastFont = nullptr;
+    unsigned mLastCharacterSize = 0;
+    sf::BlendMode mLastBlendMode;
+    bool mFirstDraw = true;
+
+    std::vector<DrawRecord> mRecords;
+    std::vector<DrawRecord> mLastFrameRecords;
+    RenderFrameStats mCurrentFrame;
+    std::vector<RenderFrameStats> mFrameStats;
+
+    void record(sf::PrimitiveType type, std::size_t vertexCount, const sf::Texture* texture, const sf::BlendMode& blendMode,
+                const sf::Font* font = nullptr, unsigned characterSize = 0);
+};
+
+#endif // RECORDING_RENDER_BACKEND_H
@@ -0,0 +1,46 @@
+#ifndef RENDER_BACKEND_H
+#define RENDER_BACKEND_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+// The render target the Renderer submits to. The Renderer only ever emits
+// vertex batches and text, so this is all a backend has to implement.
+class RenderBackend {
+public:
+    virtual ~RenderBackend() = default;
+
+    virtual void clear(const sf::Color& color) = 0;
+    virtual void setView(const sf::View& view) = 0;
+    virtual const sf::View& getDefaultView() const = 0;
+    virtual sf::Vector2u getSize() const = 0;
+
+    virtual void draw(const sf::Vertex* vertices, std::size_t vertexCount,
+                      sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default) = 0;
+    virtual void drawText(const sf::Text& text) = 0;
+
+    // Finish the frame
+    virtual void display() = 0;
+};
+
+// Submits straight to an SFML window
+class WindowRenderBackend : public RenderBackend {
+public:
+    explicit WindowRenderBackend(sf::RenderWindow& window);
+
+    void clear(const sf::Color& color) override;
+    void setView(const sf::View& view) override;
+    const sf::View& getDefaultView() const override;
+    sf::Vector2u getSize() const override;
+
+    void draw(const sf::Vertex* vertices, std::size_t vertexCount,
+              sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default) override;
+    void drawText(const sf::Text& text) override;
+
+    void display() override;
+
+private:
+    sf::RenderWindow& mWindow;
+};
+
+#endif // RENDER_BACKEND_H
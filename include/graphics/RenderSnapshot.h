@@ -0,0 +1,103 @@
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Draw layers for world sprites, drawn back to front
+enum class RenderLayer : std::uint8_t {
+    Resources,
+    Buildings,
+    Units,
+    Projectiles
+};
+
+// A single hex tile as the renderer should draw it
+struct HexCommand {
+    sf::Vector2f position;
+    sf::Color fillColor;
+    bool visible;               // false means the tile is drawn as fog
+    bool explored;              // Fogged but seen before: fillColor is the remembered terrain
+    std::uint8_t outlineEdges;  // Bit i: draw edge i (corner i to i + 1); shared edges are set on one side only
+};
+
+// A textured quad; texture == nullptr draws a flat colored quad
+struct SpriteCommand {
+    const sf::Texture* texture;
+    sf::IntRect textureRect;
+    sf::Vector2f size;          // Local size of the quad before the transform
+    sf::Transform transform;
+    sf::Color color;
+    RenderLayer layer;
+};
+
+// A screen-space rectangle for UI panels
+struct RectCommand {
+    sf::FloatRect bounds;
+    sf::Color fillColor;
+    sf::Color outlineColor;
+    float outlineThickness;
+};
+
+// Values shown in the government data panel
+struct HudData {
+    double treasury = 0.0;
+    double taxRate = 0.0;
+    double interestRate = 0.0;
+    double gdp = 0.0;
+    int qualityLevel = 0;           // Frame-budget governor level, 0 is full quality
+    std::size_t pathsPending = 0;   // Routes queued or being planned
+    std::size_t pathCacheHits = 0;
+    std::size_t pathCacheLookups = 0;
+};
+
+// Optional render work, switched off by the frame-budget governor under load
+struct RenderQuality {
+    bool drawOutlines = true;
+    bool drawFullFog = true;        // false: skip fog tiles and clear to the fog color
+};
+
+// Grid line style, switchable globally by the game
+struct GridOutlineStyle {
+    bool enabled = true;
+    float thickness = 1.f;              // Screen pixels; 1 draws plain lines
+    sf::Color color = sf::Color::Black;
+    float hideAboveZoom = 2.f;          // Hidden when zoomed out past this many world units per pixel
+};
+
+// Immutable description of one simulated frame, produced by the simulation
+// thread and consumed by the render thread. Nothing in here points at game
+// entities, only at long-lived textures owned by TextureManager.
+struct RenderSnapshot {
+    std::uint64_t frame = 0;
+    sf::View camera;
+    bool fogOfWarEnabled = true;
+    RenderQuality quality;
+    GridOutlineStyle gridOutline;
+
+    std::vector<HexCommand> hexes;
+    std::vector<sf::Vertex> tileOverlay;    // Prebuilt triangles, drawn over the grid
+    std::vector<SpriteCommand> sprites;
+    std::vector<sf::Vertex> particles;      // Prebuilt triangles, drawn over the sprites
+    std::vector<sf::Vertex> statusBars;     // Prebuilt triangles, drawn over the particles
+    std::uint64_t statusBarsRevision = 0;   // StatusOverlay revision statusBars was copied at
+    std::vector<RectCommand> interfaceRects;
+    std::uint32_t interfaceRevision = 0;    // Changes whenever interfaceRects do
+    HudData hud;
+
+    // Empty the snapshot for reuse; keeps the vectors' capacity so a
+    // steady-state frame does not allocate. The status bars are kept, to be
+    // copied again only when their revision moved on.
+    void clear() {
+        hexes.clear();
+        tileOverlay.clear();
+        sprites.clear();
+        particles.clear();
+        interfaceRects.clear();
+        hud = HudData();
+    }
+};
+
+#endif // RENDER_SNAPSHOT_H
@@ -0,0 +1,53 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <thread>
+#include "Renderer.h"
+#include "RenderSnapshot.h"
+#include "TripleBuffer.h"
+
+// Runs the Renderer on its own thread. The simulation thread fills the
+// snapshot returned by beginFrame() and calls publishFrame(); the render
+// thread always draws the latest published snapshot.
+class RenderThread {
+public:
+    RenderThread(sf::RenderWindow& window, Renderer& renderer);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    // Start/stop the render thread. The window's GL context must not be
+    // active on the calling thread while the render thread is running.
+    void start();
+    void stop();
+    bool isRunning() const { return mRunning.load(std::memory_order_acquire); }
+
+    // CPU time spent drawing the most recent frame, excluding display()
+    sf::Time getLastRenderTime() const {
+        return sf::microseconds(mLastRenderMicroseconds.load(std::memory_order_relaxed));
+    }
+
+    // Simulation side: the snapshot to fill for the current frame
+    RenderSnapshot& beginFrame();
+
+    // Simulation side: hand the filled snapshot over to the render thread
+    void publishFrame();
+
+private:
+    void run();
+
+    sf::RenderWindow& mWindow;
+    Renderer& mRenderer;
+
+    TripleBuffer<RenderSnapshot> mSnapshots;
+    std::uint64_t mNextFrame = 0;
+
+    std::thread mThread;
+    std::atomic<bool> mRunning{false};
+    std::atomic<std::int64_t> mLastRenderMicroseconds{0};
+};
+
+#endif // RENDER_THREAD_H
@@ -2,48 +2,58 @@
 #define RENDERER_H
 
 #include <SFML/Graphics.hpp>
-#include "HexGrid.h"
-#include "../GameObject.h"
+#include <array>
+#include <vector>
+#include "HudLayer.h"
+#include "RenderBackend.h"
+#include "RenderSnapshot.h"
 
+// Draws RenderSnapshots into a RenderBackend. Lives on the render thread and
+// never touches game state directly; everything it needs is in the snapshot.
 class Renderer {
 public:
-    Renderer(sf::RenderWindow& window);
-    
-    // Main render function
-    void render(const HexGrid& grid);
-    
-    // Generic render function for any GameObject
-    void render(const GameObject& gameObject);
-    
-    // Clear the screen with background color
-    void clear();
+    Renderer(RenderBackend& backend);
+
+    // Draw one snapshot
+    void render(const RenderSnapshot& snapshot);
     
-    // Display the rendered frame
+    // Present the drawn frame (blocks for the framerate limit)
     void display();
-    
-    // Set the view/camera
-    void setView(const sf::View& view);
-    
-    // Render settings for fog of war
-    void setFogOfWarEnabled(bool enabled) { mFogOfWarEnabled = enabled; }
-    bool isFogOfWarEnabled() const { return mFogOfWarEnabled; }
-    
+
     // Color for invisible (fog of war) areas
     void setFogOfWarColor(const sf::Color& color) { mUnexploredColor = color; }
-    
-    // Render a hex based on its visibility state
-    void renderHex(sf::RenderWindow& window, const Hexagon* hex);
 
 private:
-    sf::RenderWindow& mWindow;
+    RenderBackend& mBackend;
     sf::Color mBackgroundColor;
-    
+
     // Fog of war settings
-    bool mFogOfWarEnabled = true;
     sf::Color mUnexploredColor = sf::Color(20, 20, 20, 255);  // Black for non-visible areas
-    
-    // Render a fog of war overlay
-    void renderFogOfWar(sf::RenderWindow& window, const Hexagon* hex);
+
+    // Corner offsets of a hex relative to its center (pointy-top)
+    std::array<sf::Vector2f, 6> mHexCorners;
+
+    // Corner offsets of the boundary shared with neighbors, for grid lines
+    std::array<sf::Vector2f, 6> mEdgeCorners;
+
+    // Reused vertex batches, so steady-state frames don't allocate
+    std::vector<sf::Vertex> mGridVertices;
+    std::vector<sf::Vertex> mOutlineVertices;
+    std::vector<sf::Vertex> mSpriteVertices;
+    std::vector<std::size_t> mSpriteOrder;
+
+    // Retained HUD panels and text
+    HudLayer mHud;
+
+    void renderGrid(const RenderSnapshot& snapshot);
+    void renderSprites(const RenderSnapshot& snapshot);
+    void renderTileOverlay(const RenderSnapshot& snapshot);
+    void renderParticles(const RenderSnapshot& snapshot);
+    void renderStatusBars(const RenderSnapshot& snapshot);
+    void renderInterface(const RenderSnapshot& snapshot);
+
+    // Flush a run of sprite quads sharing one texture
+    void flushSprites(const sf::Texture* texture);
 };
 
-#endif // RENDERER_H 
\ No newline at end of file
+#endif // RENDERER_H
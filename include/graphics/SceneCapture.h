@@ -0,0 +1,40 @@
+#ifndef SCENE_CAPTURE_H
+#define SCENE_CAPTURE_H
+
+#include "HexGrid.h"
+#include "VisibilitySystem.h"
+#include "RenderSnapshot.h"
+#include "../GameObject.h"
+#include "../characters/Character.h"
+#include "../projectiles/ProjectilePool.h"
+
+// Fills a RenderSnapshot from world state. Shared by Game::render and the
+// headless render benchmark so both capture frames the same way.
+// snapshot.camera and snapshot.fogOfWarEnabled must be set before capturing.
+class SceneCapture {
+public:
+    // Margin around the camera so hexes don't pop in/out at the screen edge
+    static constexpr float VIEW_MARGIN = 25.0f * 4;
+
+    // Hexes in view, plus resources and buildings on visible hexes. Explored
+    // but fogged hexes show the player's memory of them instead.
+    static void captureGrid(RenderSnapshot& snapshot, const HexGrid& grid, const VisibilitySystem& visibility);
+
+    // A character, if its hex is visible
+    static void captureCharacter(RenderSnapshot& snapshot, const HexGrid& grid, const Character& character);
+
+    // Every projectile in flight, either as its type's sprite or as a small flat quad
+    static void captureProjectiles(RenderSnapshot& snapshot, const ProjectilePool& projectiles, bool asSprite);
+
+private:
+    static sf::FloatRect getCaptureArea(const sf::View& camera);
+    
+    // A fogged tile, as the player remembers it
+    static void captureMemory(RenderSnapshot& snapshot, const Hexagon& hex, int index,
+                              const VisibilitySystem& visibility);
+    
+    // Which edges of a visible tile carry its share of the grid lines
+    static std::uint8_t getOutlineEdges(const RenderSnapshot& snapshot, const HexGrid& grid, int index);
+};
+
+#endif // SCENE_CAPTURE_H
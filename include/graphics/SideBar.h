@@ -3,7 +3,10 @@
 
 #include <SFML/Graphics.hpp>
 #include <array>
+#include <cstdint>
 #include <functional>
+#include <vector>
+#include "RenderSnapshot.h"
 
 class SideBar {
     public:
@@ -19,8 +22,11 @@ class SideBar {
         SideBar(const sf::Vector2f& windowSize);
         ~SideBar();
         
-        // Draw the sidebar
-        void draw(sf::RenderWindow& window);
+        // Append the sidebar panels to a render snapshot
+        void captureRenderState(std::vector<RectCommand>& rects) const;
+        
+        // Bumped whenever the panels change, so the HUD knows when to rebuild
+        std::uint32_t getRevision() const { return mRevision; }
         
         // Handle mouse click - returns true if a cell was clicked
         bool handleClick(const sf::Vector2f& position, CellId& outClickedCell);
@@ -38,6 +44,7 @@ class SideBar {
         sf::RectangleShape mBackground;
         std::array<sf::RectangleShape, NUM_CELLS> mCells;
         std::array<std::function<void()>, NUM_CELLS> mCallbacks;
+        std::uint32_t mRevision = 0;
         
         // Converts cell ID to array index
         size_t cellIdToIndex(CellId id) const { return static_cast<size_t>(id); }
@@ -0,0 +1,77 @@
+#ifndef STATUS_OVERLAY_H
+#define STATUS_OVERLAY_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "../characters/Character.h"
+#include "../buildings/Building.h"
+
+// Health, defense and cooldown bars for units and buildings, kept in one
+// vertex array that is drawn in a single call. Every entity owns a fixed
+// slot in the array; a slot is only rewritten when the values it shows
+// (or the entity's position/visibility) changed since the last frame.
+//
+// Lives on the simulation thread; the vertices are copied into a render
+// snapshot only when the revision differs from the one the snapshot holds.
+class StatusOverlay {
+public:
+    // Two bars per entity, each a background and a fill quad
+    static constexpr std::size_t BARS_PER_ENTITY = 2;
+    static constexpr std::size_t VERTICES_PER_SLOT = BARS_PER_ENTITY * 2 * 6;
+
+    // Start a frame; entities not updated before endFrame() lose their slot
+    void beginFrame();
+
+    // Health and shoot cooldown of a unit
+    void updateCharacter(const Character& character, bool visible);
+
+    // Health and defenses of a building
+    void updateBuilding(const Building& building, bool visible);
+
+    // Release the slots of entities that are gone
+    void endFrame();
+
+    // Triangles for all bars; hidden and free slots are degenerate
+    const std::vector<sf::Vertex>& getVertices() const { return mVertices; }
+
+    // Slots rewritten in the last frame
+    std::size_t getRebuiltCount() const { return mRebuiltCount; }
+
+    // Changes whenever the vertices do
+    std::uint64_t getRevision() const { return mRevision; }
+
+private:
+    // What a slot currently shows
+    struct BarValues {
+        sf::Vector2f position;
+        bool visible = false;
+        float fractions[BARS_PER_ENTITY] = {};
+        sf::Color colors[BARS_PER_ENTITY];
+
+        bool operator==(const BarValues& other) const;
+    };
+
+    struct Slot {
+        std::uint32_t id = 0;
+        std::uint64_t lastSeen = 0;
+        BarValues values;
+    };
+
+    std::vector<sf::Vertex> mVertices;
+    std::vector<Slot> mSlots;
+    std::vector<std::size_t> mFreeSlots;
+    std::unordered_map<std::uint32_t, std::size_t> mSlotById;
+
+    std::uint64_t mFrame = 0;
+    std::size_t mRebuiltCount = 0;
+    std::uint64_t mRevision = 0;
+
+    void updateEntity(std::uint32_t id, const BarValues& values);
+    std::size_t acquireSlot(std::uint32_t id);
+    void writeSlot(std::size_t slot);
+    void clearSlot(std::size_t slot);
+};
+
+#endif // STATUS_OVERLAY_H
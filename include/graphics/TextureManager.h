@@ -20,8 +20,18 @@ public:
     TextureManager(const TextureManager&) = delete;
     TextureManager& operator=(const TextureManager&) = delete;
     
+    // With textures disabled nothing is loaded or created, so nothing needs
+    // a GPU: getTexture returns nullptr and objects take their texture-less
+    // paths. For headless tools such as the render bench.
+    void setTexturesEnabled(bool enabled) { mTexturesEnabled = enabled; }
+    bool areTexturesEnabled() const { return mTexturesEnabled; }
+    
     // Get a texture; loads it if not already loaded
     sf::Texture* getTexture(const std::string& filename) {
+        if (!mTexturesEnabled) {
+            return nullptr;
+        }
+        
         // Check if the texture is already loaded
         auto it = mTextures.find(filename);
         if (it != mTextures.end()) {
@@ -43,6 +53,13 @@ public:
         return result;
     }
     
+    // Store a texture created in memory under a name; returns the stored texture
+    sf::Texture* addTexture(const std::string& name, sf::Texture&& texture) {
+        std::unique_ptr<sf::Texture>& slot = mTextures[name];
+        slot = std::make_unique<sf::Texture>(std::move(texture));
+        return slot.get();
+    }
+    
     // Clear all textures
     void clearAll() {
         mTextures.clear();
@@ -54,6 +71,7 @@ private:
     
     // Storage for textures
     std::unordered_map<std::string, std::unique_ptr<sf::Texture>> mTextures;
+    bool mTexturesEnabled = true;
 };
 
 #endif // TEXTURE_MANAGER_H 
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef TILE_OVERLAY_H
+#define TILE_OVERLAY_H
+
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include "HexGrid.h"
+
+// Translucent hexes laid over a set of tiles, such as a unit's movement
+// range. The triangles are built once when the set changes and drawn in a
+// single call, instead of recoloring every hex one by one.
+//
+// Lives on the simulation thread; the vertices are copied into the render
+// snapshot each frame.
+class TileOverlay {
+public:
+    // Six triangles per tile
+    static constexpr std::size_t VERTICES_PER_TILE = 18;
+    
+    // Cover these tiles (HexGrid tile indices) in one color
+    void setTiles(const HexGrid& grid, const std::vector<int>& tiles, const sf::Color& color);
+    
+    void clear() { mVertices.clear(); }
+    bool isEmpty() const { return mVertices.empty(); }
+    
+    const std::vector<sf::Vertex>& getVertices() const { return mVertices; }
+    
+private:
+    std::vector<sf::Vertex> mVertices;
+};
+
+#endif // TILE_OVERLAY_H
@@ -0,0 +1,53 @@
+#ifndef TRIPLE_BUFFER_H
+#define TRIPLE_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single-producer / single-consumer handoff of the latest value.
+// The producer always owns one buffer, the consumer owns another, and the
+// third sits in the middle. Publishing swaps the producer's buffer into the
+// middle; acquiring swaps the middle into the consumer if it is newer.
+// Neither side ever blocks, and the consumer always sees the latest publish.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    // Producer side: the buffer to fill for the next publish
+    T& writeBuffer() { return mBuffers[mWriteIndex]; }
+
+    // Producer side: hand the write buffer over to the consumer
+    void publish() {
+        std::uint8_t previous = mMiddle.exchange(mWriteIndex | FRESH_BIT, std::memory_order_acq_rel);
+        mWriteIndex = previous & INDEX_MASK;
+    }
+
+    // Consumer side: take the most recent publish, returns false if nothing new arrived
+    bool acquire() {
+        if ((mMiddle.load(std::memory_order_relaxed) & FRESH_BIT) == 0) {
+            return false;
+        }
+        std::uint8_t previous = mMiddle.exchange(mReadIndex, std::memory_order_acq_rel);
+        mReadIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    // Consumer side: the buffer taken by the last successful acquire()
+    const T& readBuffer() const { return mBuffers[mReadIndex]; }
+
+private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t FRESH_BIT = 0x4;
+
+    std::array<T, 3> mBuffers;
+    std::uint8_t mWriteIndex = 0;
+    std::atomic<std::uint8_t> mMiddle{1};
+    std::uint8_t mReadIndex = 2;
+};
+
+#endif // TRIPLE_BUFFER_H
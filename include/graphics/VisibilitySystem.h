@@ -2,34 +2,193 @@
 #define VISIBILITY_SYSTEM_H
 
 #include "HexGrid.h"
+#include "LineOfSight.h"
 #include "../characters/Character.h"
 #include "../buildings/Building.h"
-#include "../buildings/City.h"
+#include <cstdint>
+#include <unordered_map>
 #include <vector>
 #include <memory>
 
+// Incremental fog of war for every faction at once. Every tile keeps a count
+// per faction of the observers that see it; adding, moving or removing an
+// observer only subtracts its old disk and adds its new one, and a faction's
+// visibility bit on a hex (Hexagon::isVisibleTo) only changes when its count
+// goes between zero and non-zero. Nothing is recomputed while nothing moves.
+//
+// Tiles stay explored once seen. When a tile drops out of a faction's view,
+// what was on it (terrain, and any building not its own) is copied into that
+// faction's memory, so it can be drawn under fog without holding on to the
+// entity or scanning the map.
+//
+// Buildings and cities never move, so they are static observers: registered
+// once, with their combined coverage kept as a per-tile bitmask of factions
+// that is only rebuilt when one is added, removed or changes range. A tile is
+// visible to a faction while one of its units sees it or its static coverage
+// does.
+//
+// Every visibility bit change is also appended to a per-tick change list,
+// so other systems can follow visibility without diffing the map.
+//
+// An observer sees either a plain disk or, in line-of-sight mode, only what
+// FOREST and URBAN tiles don't hide (see LineOfSightTable).
 class VisibilitySystem {
 public:
+    // Observers are keyed by entity id (GameObject::getId, City::getId)
+    using ObserverId = std::uint32_t;
+    
+    // What a faction last saw of a building on a tile it no longer sees
+    struct RememberedStructure {
+        SpriteCommand sprite;       // As it was drawn then; textures outlive the entity
+        BuildingType type;
+        Allegiance allegiance;
+    };
+    
+    // One tile becoming visible or hidden to one faction
+    struct VisibilityChange {
+        std::int32_t tile;
+        Allegiance faction;
+        bool becameVisible;
+    };
+    
+    // What a faction last saw of a tile, valid once the tile is explored
+    struct TileMemory {
+        sf::Color terrainColor;
+        TerrainType terrain = TerrainType::PLAINS;
+        std::int32_t structure = -1;    // Index of the RememberedStructure, -1 for none
+    };
+    
     // Default visibility range for generic buildings
     static constexpr int BUILDING_VISIBILITY_RANGE = 2;
     
+    // Visibility range around a city's first hex
+    static constexpr int CITY_VISIBILITY_RANGE = 2;
+    
     VisibilitySystem();
     
-    // Update visibility based on entities
-    void updateVisibility(HexGrid& grid, 
-                          const std::vector<Character*>& characters,
-                          const std::vector<Building*>& buildings,
-                          const std::vector<City*>& cities);
+    // Bring the unit observers in line with the characters given, of every
+    // allegiance, in one pass: new ones are added, moved ones updated and
+    // missing ones removed. Only the observers that changed touch the grid.
+    // Pending static observer changes are applied as well.
+    void updateVisibility(HexGrid& grid, const std::vector<Character*>& characters);
+    
+    // Unit observer changes, for callers that know exactly what happened
+    void addObserver(HexGrid& grid, ObserverId id, Allegiance faction, const Hexagon::CubeCoord& center,
+                     int range, bool lineOfSight = false);
+    void moveObserver(HexGrid& grid, ObserverId id, const Hexagon::CubeCoord& center);
+    void removeObserver(HexGrid& grid, ObserverId id);
+    bool hasObserver(ObserverId id) const { return mObservers.count(id) > 0; }
+    
+    // Static observers (buildings, cities). Changes are batched until the next
+    // updateStaticCoverage, so registering many at once costs one rebuild.
+    void addStaticObserver(ObserverId id, Allegiance faction, int centerTile, int range);
+    void removeStaticObserver(ObserverId id);
+    void setStaticObserverRange(ObserverId id, int range);
+    bool hasStaticObserver(ObserverId id) const { return mStaticObservers.count(id) > 0; }
+    
+    // Rebuild the static coverage if a static observer changed since the last
+    // call, and show or hide the tiles whose coverage changed
+    void updateStaticCoverage(HexGrid& grid);
+    
+    // With fog of war off every tile is flagged visible to the player
+    // (FRIENDLY); the counts keep being maintained so turning it back on is
+    // exact. Other factions are unaffected.
+    void setFogOfWarEnabled(HexGrid& grid, bool enabled);
+    
+    // Terrain that blocks line of sight
+    static bool blocksSight(TerrainType terrain) {
+        return terrain == TerrainType::FOREST || terrain == TerrainType::URBAN;
+    }
+    
+    // Start a new tick: forget the previous tick's changes
+    void beginTick() { mChanges.clear(); }
+    
+    // Changes since beginTick(), in the order they happened. A tile can
+    // appear more than once if it flipped back and forth within the tick.
+    const std::vector<VisibilityChange>& getChanges() const { return mChanges; }
+    
+    // Last-seen state of a tile for a faction; only meaningful while the tile
+    // is explored but not visible to it
+    const TileMemory& getTileMemory(int tileIndex, Allegiance faction) const {
+        return mMemory[tileIndex * FACTION_COUNT + static_cast<int>(faction)];
+    }
     
-    // Set hexes visible in a radius around a coordinate
-    void setHexesVisibleAroundEntity(HexGrid& grid, const Hexagon::CubeCoord& center, int range);
+    // Building a faction remembers on a tile, or nullptr
+    const RememberedStructure* getRememberedStructure(int tileIndex, Allegiance faction) const;
     
-    // Reset visibility for debugging/testing
+    // Number of unit observers of a faction that see a tile
+    int getViewerCount(int tileIndex, Allegiance faction) const;
+    
+    // Whether a faction's buildings or cities see a tile
+    bool isStaticallyCovered(int tileIndex, Allegiance faction) const {
+        return tileIndex >= 0 && static_cast<std::size_t>(tileIndex) < mStaticCoverage.size()
+            && (mStaticCoverage[tileIndex] & factionBit(faction)) != 0;
+    }
+    
+    // Drop every observer and hide the whole map, for debugging/testing
     void resetAllVisibility(HexGrid& grid);
     
 private:
+    struct Observer {
+        Allegiance faction = Allegiance::NEUTRAL;
+        int center = -1;            // Tile index
+        int range = 0;
+        bool lineOfSight = false;
+        std::vector<int> tiles;     // Tiles this observer counted, so removal is exact
+        std::uint64_t lastSync = 0;
+    };
+    
+    struct StaticObserver {
+        Allegiance faction = Allegiance::NEUTRAL;
+        int center = -1;            // Tile index
+        int range = 0;
+    };
+    
+    std::unordered_map<ObserverId, Observer> mObservers;
+    std::unordered_map<ObserverId, StaticObserver> mStaticObservers;
+    std::vector<std::uint8_t> mStaticCoverage;  // Per tile, factionBit of every faction whose static observers see it
+    std::vector<std::uint8_t> mStaticScratch;   // Coverage being rebuilt
+    bool mStaticDirty = false;
+    std::vector<std::uint16_t> mViewerCounts;   // Indexed by tile * FACTION_COUNT + faction
+    std::vector<VisibilityChange> mChanges;
+    std::vector<TileMemory> mMemory;            // Indexed like mViewerCounts
+    std::vector<RememberedStructure> mStructures;
+    std::vector<std::int32_t> mFreeStructures;
+    std::vector<SpriteCommand> mSpriteScratch;
+    std::vector<std::uint8_t> mSightBlocked;    // Scratch for line-of-sight stamping, per table entry
+    std::uint64_t mSyncCount = 0;
+    bool mFogOfWarEnabled = true;
+    
+    // Make sure the counts cover the grid
+    void ensureGrid(const HexGrid& grid);
+    
+    // Whether a faction sees a tile through any observer
+    bool isSeen(int index, Allegiance faction) const {
+        return mViewerCounts[index * FACTION_COUNT + static_cast<int>(faction)] > 0
+            || (mStaticCoverage[index] & factionBit(faction)) != 0;
+    }
+    
+    // Add or move an observer as part of a sync pass
+    void syncObserver(HexGrid& grid, ObserverId id, Allegiance faction, const Hexagon::CubeCoord& center,
+                      int range, bool lineOfSight);
+    
+    // Count / uncount an observer's tiles
+    void stamp(HexGrid& grid, Observer& observer);
+    void unstamp(HexGrid& grid, Observer& observer);
+    
+    // Add one viewer to a tile
+    void countTile(HexGrid& grid, Observer& observer, int index);
+    
+    // Set a faction's bit on a hex, unless fog of war is off and it's the player's
+    void setTileVisible(HexGrid& grid, int index, Allegiance faction, bool visible);
+    
+    // Apply a visible/hidden transition: mark explored, or record the tile's memory
+    void applyTransition(HexGrid& grid, int index, Allegiance faction, bool visible);
+    void remember(const Hexagon& hex, int index, Allegiance faction);
+    void forgetStructure(int index, Allegiance faction);
+    
     // Get appropriate visibility range based on building type (deprecated)
     int getBuildingVisibilityRange(BuildingType type) const;
 };
 
-#endif // VISIBILITY_SYSTEM_H 
\ No newline at end of file
+#endif // VISIBILITY_SYSTEM_H
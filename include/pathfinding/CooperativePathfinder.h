@@ -0,0 +1,89 @@
+#ifndef COOPERATIVE_PATHFINDER_H
+#define COOPERATIVE_PATHFINDER_H
+
+#include "NavigationGrid.h"
+#include "MovementCosts.h"
+#include "ReservationTable.h"
+#include "FlowField.h"
+#include "LandmarkTable.h"
+#include <cstdint>
+#include <vector>
+
+// Space-time A* against a ReservationTable (windowed cooperative A*). A
+// search state is a tile at a move step, and every step a unit either moves
+// to a neighbor or waits where it is. Units plan one after another, each
+// reserving its path before the next plans, so later units route around or
+// wait for earlier ones instead of walking into them.
+//
+// Only the next ReservationTable::HORIZON - 1 steps are searched; a path
+// that can't reach the goal in that window ends at the most promising tile
+// and is planned again from there. A tile held by a unit without
+// reservations, one standing idle, is blocked for the whole window.
+//
+// Visited states live in an open-addressed table stamped with a search
+// number, so a search allocates nothing once the buffers have grown.
+class CooperativePathfinder {
+public:
+    // Steps searched ahead of the current one
+    static constexpr int WINDOW = ReservationTable::HORIZON - 1;
+    
+    // Cost of standing still for a step, less than any move
+    static constexpr int WAIT_COST = 1;
+    
+    // Bound on the work done by one search
+    static constexpr int MAX_EXPANSIONS = 16384;
+    
+    // Plan from start towards goal for the steps after the table's current
+    // one. On success path holds the tile for each step, waits repeating
+    // the tile, ending at the goal or at the end of the window. With a flow
+    // field for the goal the search is guided by its exact costs, and ends
+    // as close to the goal as it can get when the goal is taken. Without
+    // one, landmarks built for the same costs tighten the heuristic.
+    bool findPath(const NavigationGrid& grid, const ReservationTable& reservations, int start, int goal,
+                  const MovementCosts& costs, Allegiance faction, std::uint32_t owner,
+                  std::vector<int>& path, const FlowField* field = nullptr,
+                  const LandmarkTable* landmarks = nullptr);
+    
+    // Whether the last path found ends on the goal
+    bool reachesGoal() const { return mReachesGoal; }
+    
+    // States taken off the open list by the last search
+    int getNodesExpanded() const { return mNodesExpanded; }
+    
+private:
+    struct Node {
+        int tile;
+        int step;       // Steps after the current one
+        int cost;
+        int parent;     // Node index, -1 for the start
+    };
+    
+    struct OpenNode {
+        int priority;
+        int cost;
+        int node;
+    };
+    
+    std::vector<Node> mNodes;
+    std::vector<OpenNode> mOpen;
+    
+    // State key to node index, valid when the slot's stamp matches
+    std::vector<std::uint64_t> mSlotKey;
+    std::vector<std::int32_t> mSlotNode;
+    std::vector<std::uint32_t> mSlotSearch;
+    std::uint32_t mSearch = 0;
+    
+    bool mReachesGoal = false;
+    int mNodesExpanded = 0;
+    
+    void beginSearch();
+    
+    // Node index for a state, added with the given cost if it isn't known;
+    // sets isNew accordingly. -1 when the table is full.
+    int findOrAdd(int tile, int step, int cost, bool& isNew);
+    
+    // Whether a unit arriving at the goal on a step can stay there
+    bool canHold(const ReservationTable& reservations, int tile, std::uint64_t step, std::uint32_t owner) const;
+};
+
+#endif // COOPERATIVE_PATHFINDER_H
@@ -0,0 +1,92 @@
+#ifndef FLOW_FIELD_H
+#define FLOW_FIELD_H
+
+#include "NavigationGrid.h"
+#include "MovementCosts.h"
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// Cost to reach one goal from every tile, for one kind of unit, with the next
+// tile to step to. Built by a single Dijkstra outward from the goal, it
+// replaces one A* per unit when many units head to the same place: each of
+// them just follows getNextTile, and only searches around the others when
+// the step it gives is taken.
+//
+// Units don't block the field itself, only the step about to be taken; see
+// getNextTile. Buildings of other factions do.
+class FlowField {
+public:
+    static constexpr std::uint32_t UNREACHABLE = 0xffffffffu;
+    
+    int getGoal() const { return mGoal; }
+    
+    // Cost from a tile to the goal, or UNREACHABLE
+    std::uint32_t getCost(int tile) const { return mCost[tile]; }
+    bool reaches(int tile) const { return mCost[tile] != UNREACHABLE; }
+    
+    // Tile to step to from a tile, or -1 at the goal or when it can't be
+    // reached. If the best step holds a unit, any free neighbor that is still
+    // closer to the goal will do; -1 if there is none, meaning wait.
+    int getNextTile(const NavigationGrid& grid, int tile) const;
+    
+private:
+    friend class FlowFieldCache;
+    
+    int mGoal = -1;
+    std::vector<std::uint32_t> mCost;
+    std::vector<std::int32_t> mNext;
+};
+
+// Flow fields shared by every unit heading to the same goal, keyed by goal,
+// movement costs and faction. Least recently used fields are dropped past
+// MAX_FIELDS.
+//
+// Listening to the NavigationGrid, a terrain or building change only drops
+// the fields it can affect: those that reach the tile or one of its
+// neighbors. Unit movement never invalidates a field.
+class FlowFieldCache {
+public:
+    static constexpr std::size_t MAX_FIELDS = 16;
+    
+    // The field for a goal, built now if it isn't cached
+    const FlowField& getField(const NavigationGrid& grid, int goal, const MovementCosts& costs, Allegiance faction);
+    
+    // Cached field for a goal, or nullptr
+    const FlowField* findField(int goal, const MovementCosts& costs, Allegiance faction) const;
+    
+    // Pass NavigationGrid changes here
+    void onTileChanged(const NavigationGrid& grid, int tile, NavigationChange change);
+    
+    void clear();
+    
+    std::size_t getFieldCount() const { return mFields.size(); }
+    
+    // Fields built since the cache was created
+    std::size_t getBuildCount() const { return mBuildCount; }
+    
+private:
+    struct Entry {
+        std::uint64_t key;
+        FlowField field;
+    };
+    
+    struct OpenNode {
+        std::uint32_t cost;
+        int tile;
+    };
+    
+    // Most recently used first
+    std::list<Entry> mFields;
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> mIndex;
+    std::vector<OpenNode> mOpen;
+    std::uint32_t mRevision = 0;
+    std::size_t mBuildCount = 0;
+    
+    static std::uint64_t makeKey(int goal, const MovementCosts& costs, Allegiance faction);
+    
+    void build(const NavigationGrid& grid, int goal, const MovementCosts& costs, Allegiance faction, FlowField& field);
+};
+
+#endif // FLOW_FIELD_H
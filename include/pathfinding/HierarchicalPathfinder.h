@@ -0,0 +1,146 @@
+#ifndef HIERARCHICAL_PATHFINDER_H
+#define HIERARCHICAL_PATHFINDER_H
+
+#include "NavigationGrid.h"
+#include "MovementCosts.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// HPA* for one kind of unit. The map is cut into CLUSTER_SIZE x CLUSTER_SIZE
+// blocks of axial coordinates; every run of passable tiles along the border
+// of two clusters becomes an entrance, a pair of abstract nodes on either
+// side, and the nodes of each cluster are linked by their cheapest path
+// inside it. A long route is then an A* over that small graph, giving
+// waypoints about a cluster apart, and the tiles between two waypoints are
+// left for the unit to plan with a short A* as it gets there.
+//
+// The abstract graph only knows terrain; units and buildings are handled by
+// the short searches between waypoints. A terrain change marks its cluster
+// dirty, and the next query rebuilds just that cluster's entrances and the
+// links of the clusters around it.
+class HierarchicalPathfinder {
+public:
+    static constexpr int CLUSTER_SIZE = 16;
+    
+    explicit HierarchicalPathfinder(const MovementCosts& costs);
+    
+    // Cut the grid into clusters and build the whole abstract graph
+    void build(const NavigationGrid& grid);
+    
+    // Pass NavigationGrid changes here
+    void onTileChanged(int tile, NavigationChange change);
+    
+    struct Edge {
+        int node;
+        int cost;
+    };
+    
+    struct OpenNode {
+        int priority;
+        int cost;
+        int id;                     // Tile or node, depending on the search
+    };
+    
+    // Scratch space for one search at a time. The graph itself is only read
+    // by a query, so threads can search one graph at once, each with its own
+    // Query, as long as nothing refreshes or rebuilds it meanwhile.
+    struct Query {
+        std::vector<int> tileCost;
+        std::vector<std::uint32_t> tileSearch;
+        std::uint32_t search = 0;
+        std::vector<OpenNode> open;
+        std::vector<int> nodeCost;
+        std::vector<int> nodeParent;
+        std::vector<std::uint32_t> nodeSearch;
+        std::vector<int> goalCost;
+        std::vector<std::uint32_t> goalSearch;
+        std::vector<Edge> startEdges;
+        int nodesExpanded = 0;
+    };
+    
+    // Apply terrain changes to the graph, rebuilding it if the grid was
+    // rebuilt. Queries need it done first.
+    void refresh(const NavigationGrid& grid);
+    
+    // Waypoints from start to goal, start excluded, ending with the goal.
+    // Consecutive waypoints are in the same or neighboring clusters.
+    // query.nodesExpanded counts the abstract nodes the search took.
+    bool findWaypoints(const NavigationGrid& grid, int start, int goal, std::vector<int>& waypoints,
+                       Query& query) const;
+    
+    // Tiles walked along waypoints from start, start excluded: the cheapest
+    // way through each cluster, found again with the terrain as it is now.
+    // False, with route cleared, if some leg can no longer be walked.
+    bool traceRoute(const NavigationGrid& grid, int start, const std::vector<int>& waypoints,
+                    std::vector<int>& route, Query& query) const;
+    
+    // Cluster a tile is in; units starting in the same one can share routes
+    int getRegion(int tile) const { return mClusterOf[tile]; }
+    
+    const MovementCosts& getCosts() const { return mCosts; }
+    int getClusterCount() const { return static_cast<int>(mClusters.size()); }
+    int getNodeCount() const { return static_cast<int>(mNodes.size() - mFreeNodes.size()); }
+    
+private:
+    // One side of an entrance
+    struct Node {
+        int tile = -1;
+        int cluster = -1;
+        int partner = -1;           // Node on the other side of the entrance
+        int partnerCost = 0;        // Cost of stepping across to it
+        std::vector<Edge> links;    // Other nodes of the same cluster, with path cost
+    };
+    
+    struct Cluster {
+        std::vector<int> tiles;
+        std::vector<int> nodes;
+        std::vector<int> neighbors; // Clusters sharing a border with this one
+        bool dirty = false;
+    };
+    
+    // A step across a cluster border
+    struct Crossing {
+        int inside;
+        int outside;
+    };
+    
+    MovementCosts mCosts;
+    std::uint32_t mRevision = 0;
+    bool mBuilt = false;
+    int mRadius = 0;
+    int mClustersPerAxis = 0;
+    
+    std::vector<int> mClusterOf;
+    std::vector<Cluster> mClusters;
+    std::vector<Node> mNodes;
+    std::vector<int> mFreeNodes;
+    std::unordered_map<std::uint64_t, std::vector<int>> mEntrances;  // Lower cluster's nodes per cluster pair
+    std::vector<int> mDirtyClusters;
+    
+    std::vector<Crossing> mRun;         // Border crossings being grouped into an entrance
+    std::vector<int> mAffected;
+    
+    // Scratch for building the graph
+    Query mQuery;
+    
+    static std::uint64_t pairKey(int a, int b);
+    
+    int allocateNode();
+    void buildEntrances(const NavigationGrid& grid, int a, int b);
+    void removeEntrances(int a, int b);
+    void buildLinks(const NavigationGrid& grid, int cluster);
+    void refreshDirtyClusters(const NavigationGrid& grid);
+    
+    // Dijkstra restricted to one cluster. Forward gives the cost from the
+    // source to each tile, reverse the cost from each tile to the source.
+    // Results are read with tileCost.
+    void searchCluster(const NavigationGrid& grid, int cluster, int source, bool reverse, Query& query) const;
+    static int tileCost(const Query& query, int tile) {
+        return query.tileSearch[tile] == query.search ? query.tileCost[tile] : -1;
+    }
+    
+    bool canEnter(const NavigationGrid& grid, int tile) const { return mCosts.canEnter(grid.getTerrain(tile)); }
+};
+
+#endif // HIERARCHICAL_PATHFINDER_H
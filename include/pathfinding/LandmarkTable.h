@@ -0,0 +1,74 @@
+#ifndef LANDMARK_TABLE_H
+#define LANDMARK_TABLE_H
+
+#include "NavigationGrid.h"
+#include "MovementCosts.h"
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+// Landmark (ALT) heuristic for one kind of unit. A few landmarks are picked
+// around the edge of the map and the cost from each of them to every tile
+// is computed once, at load. By the triangle inequality those costs give a
+// lower bound on the cost between any two tiles that, unlike hex distance,
+// knows about the lakes and forests in between, so A* spends far fewer
+// expansions on the wrong side of them.
+//
+// Costs only account for terrain, so the bound holds whatever units and
+// buildings are in the way. A terrain change makes the table stale, and
+// a stale table gives no bound at all until it is built again.
+class LandmarkTable {
+public:
+    static constexpr int DEFAULT_LANDMARKS = 8;
+    static constexpr std::uint32_t UNREACHABLE = 0xffffffffu;
+    
+    explicit LandmarkTable(const MovementCosts& costs, int landmarkCount = DEFAULT_LANDMARKS);
+    
+    // Pick the landmarks and fill the tables, one landmark per worker thread
+    void build(const NavigationGrid& grid);
+    
+    // Whether the tables match the grid's terrain
+    bool isValid() const { return mValid; }
+    
+    // Pass NavigationGrid changes here
+    void onTileChanged(int tile, NavigationChange change);
+    
+    // Lower bound on the cost of walking from tile to goal; 0 if unknown
+    int lowerBound(const NavigationGrid& grid, int tile, int goal) const;
+    
+    // Store the tables, or load ones stored for the same terrain and costs.
+    // read returns false and leaves the table untouched on any mismatch.
+    void write(std::ostream& out) const;
+    bool read(std::istream& in, const NavigationGrid& grid);
+    
+    const MovementCosts& getCosts() const { return mCosts; }
+    const std::vector<int>& getLandmarks() const { return mLandmarks; }
+    
+private:
+    struct OpenNode {
+        std::uint32_t cost;
+        int tile;
+    };
+    
+    MovementCosts mCosts;
+    int mLandmarkCount;
+    std::vector<int> mLandmarks;
+    
+    // Cost from each landmark to each tile, all of a tile's landmarks together
+    std::vector<std::uint32_t> mDistance;
+    
+    std::uint64_t mTerrainHash = 0;
+    bool mValid = false;
+    
+    // Passable tiles furthest from the center, one per slice of the map
+    void pickLandmarks(const NavigationGrid& grid);
+    
+    // Dijkstra out of one landmark into a landmark-major column
+    void computeDistances(const NavigationGrid& grid, int landmark, std::vector<std::uint32_t>& column,
+                          std::vector<OpenNode>& open) const;
+    
+    static std::uint64_t hashTerrain(const NavigationGrid& grid);
+};
+
+#endif // LANDMARK_TABLE_H
@@ -0,0 +1,60 @@
+#ifndef MOVEMENT_COSTS_H
+#define MOVEMENT_COSTS_H
+
+#include "../Hexagon.h"
+#include <array>
+#include <cstdint>
+
+// A set of terrain types, one bit per TerrainType
+using TerrainMask = std::uint8_t;
+
+constexpr TerrainMask terrainBit(TerrainType terrain) {
+    return static_cast<TerrainMask>(1u << static_cast<int>(terrain));
+}
+
+// Which terrain one kind of unit can cross, and the cost of entering a tile
+// of each terrain type. Built at compile time from a terrain mask, so the
+// inner loops of the searches test a bit and index a table. Costs are small
+// integers so path costs add up exactly; terrain a unit can't cross has no
+// cost at all.
+struct MovementCosts {
+    static constexpr std::uint16_t IMPASSABLE = 0;
+    
+    // Move points a unit gets per point of speed: one tile of plains
+    static constexpr int POINTS_PER_SPEED = 2;
+    
+    // Base cost of entering each terrain, indexed by TerrainType
+    static constexpr std::array<std::uint16_t, TERRAIN_TYPE_COUNT> TERRAIN_COSTS = {
+        2,  // PLAINS
+        6,  // WATER
+        4,  // FOREST
+        2   // URBAN
+    };
+    
+    TerrainMask traversable = 0;
+    std::array<std::uint16_t, TERRAIN_TYPE_COUNT> enterCost = {};
+    std::uint16_t minCost = 0;      // Cheapest passable terrain, scales the A* heuristic
+    
+    // Base costs for the terrain types in a mask
+    static constexpr MovementCosts fromMask(TerrainMask mask) {
+        MovementCosts costs;
+        costs.traversable = mask;
+        for (int index = 0; index < TERRAIN_TYPE_COUNT; ++index) {
+            if (mask & (1u << index)) {
+                costs.enterCost[index] = TERRAIN_COSTS[index];
+                if (costs.minCost == 0 || TERRAIN_COSTS[index] < costs.minCost) {
+                    costs.minCost = TERRAIN_COSTS[index];
+                }
+            }
+        }
+        return costs;
+    }
+    
+    constexpr bool canEnter(TerrainType terrain) const { return (traversable & terrainBit(terrain)) != 0; }
+    constexpr int getCost(TerrainType terrain) const { return enterCost[static_cast<int>(terrain)]; }
+    
+    bool operator==(const MovementCosts& other) const { return enterCost == other.enterCost; }
+    bool operator!=(const MovementCosts& other) const { return !(*this == other); }
+};
+
+#endif // MOVEMENT_COSTS_H
@@ -0,0 +1,49 @@
+#ifndef MOVEMENT_RANGE_H
+#define MOVEMENT_RANGE_H
+
+#include "NavigationGrid.h"
+#include "MovementCosts.h"
+#include <cstdint>
+#include <vector>
+
+// Tiles a unit can reach this turn with its move points: a Dijkstra from the
+// unit that stops where the points run out. As long as a unit has points
+// left it may always take one more step, even onto terrain that costs more
+// than it has, so a unit can always enter any passable neighbor.
+//
+// The cost map and open list are reused between computations and stamped
+// rather than cleared, so selecting a unit allocates nothing once the
+// buffers have grown to the map size.
+class MovementRange {
+public:
+    // Fill the range of a unit standing on start with a number of move points
+    void compute(const NavigationGrid& grid, int start, int movePoints, const MovementCosts& costs,
+                 Allegiance faction);
+    
+    // Reachable tiles in order of cost, start excluded
+    const std::vector<int>& getTiles() const { return mTiles; }
+    
+    // Move points spent to reach a tile, -1 if it is out of range
+    int getCost(int tile) const {
+        return tile >= 0 && tile < static_cast<int>(mSearchOf.size()) && mSearchOf[tile] == mSearch
+            ? mCost[tile] : -1;
+    }
+    bool contains(int tile) const { return getCost(tile) > 0; }
+    
+    int getStart() const { return mStart; }
+    
+private:
+    struct OpenNode {
+        int cost;
+        int tile;
+    };
+    
+    std::vector<int> mCost;
+    std::vector<std::uint32_t> mSearchOf;
+    std::uint32_t mSearch = 0;
+    std::vector<OpenNode> mOpen;
+    std::vector<int> mTiles;
+    int mStart = -1;
+};
+
+#endif // MOVEMENT_RANGE_H
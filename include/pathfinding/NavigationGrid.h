@@ -0,0 +1,93 @@
+#ifndef NAVIGATION_GRID_H
+#define NAVIGATION_GRID_H
+
+#include "../graphics/HexGrid.h"
+#include "../Allegiance.h"
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <vector>
+
+// What changed on a tile
+enum class NavigationChange {
+    Terrain,
+    Building,
+    Unit
+};
+
+// What pathfinding needs to know about the map, in flat arrays indexed like
+// HexGrid tiles: terrain, neighbors, coordinates for the heuristic, and which
+// tiles hold a unit or a building. Searches read only this, never the
+// Hexagons, so they touch a few bytes per tile and no pointers.
+//
+// The game keeps it in sync by calling setUnit / setBuilding / setTerrain
+// when those change. Each real change is passed on to the listeners, so
+// cached pathfinding data can drop just what the change touches.
+class NavigationGrid {
+public:
+    using ChangeListener = std::function<void(int tile, NavigationChange change)>;
+    
+    // No building on a tile
+    static constexpr std::int8_t NO_OWNER = -1;
+    
+    NavigationGrid() = default;
+    explicit NavigationGrid(const HexGrid& grid);
+    
+    // Copy terrain, neighbors, units and buildings from the grid. Listeners
+    // aren't told; a new revision tells cached data to start over.
+    void build(const HexGrid& grid);
+    std::uint32_t getRevision() const { return mRevision; }
+    
+    // Copy another grid's tiles but not its listeners, as a read-only frame
+    // for other threads. Neighbors and coordinates are only copied again
+    // when the other grid has been rebuilt since.
+    void copyFrom(const NavigationGrid& other);
+    
+    // Called for every tile change from now on
+    void addListener(ChangeListener listener) { mListeners.push_back(std::move(listener)); }
+    
+    int getTileCount() const { return static_cast<int>(mTerrain.size()); }
+    int getNeighbor(int tile, int direction) const { return mNeighbors[tile][direction]; }
+    TerrainType getTerrain(int tile) const { return static_cast<TerrainType>(mTerrain[tile]); }
+    
+    // Axial coordinates of a tile
+    int getQ(int tile) const { return mQ[tile]; }
+    int getR(int tile) const { return mR[tile]; }
+    
+    // Hex distance between two tiles
+    int distance(int a, int b) const {
+        int dq = mQ[a] - mQ[b];
+        int dr = mR[a] - mR[b];
+        return (std::abs(dq) + std::abs(dr) + std::abs(dq + dr)) / 2;
+    }
+    
+    bool hasUnit(int tile) const { return mUnit[tile] != 0; }
+    
+    // Allegiance of the building on a tile, or NO_OWNER
+    std::int8_t getBuildingOwner(int tile) const { return mBuildingOwner[tile]; }
+    
+    // Whether a faction's units may stand on a tile; buildings of other
+    // factions keep them out
+    bool isBlockedFor(int tile, Allegiance faction) const {
+        return mBuildingOwner[tile] != NO_OWNER && mBuildingOwner[tile] != static_cast<std::int8_t>(faction);
+    }
+    
+    void setUnit(int tile, bool present);
+    void setBuilding(int tile, std::int8_t owner);
+    void setTerrain(int tile, TerrainType terrain);
+    
+private:
+    std::vector<std::uint8_t> mTerrain;
+    std::vector<std::uint8_t> mUnit;
+    std::vector<std::int8_t> mBuildingOwner;
+    std::vector<std::array<int, 6>> mNeighbors;
+    std::vector<int> mQ;
+    std::vector<int> mR;
+    std::vector<ChangeListener> mListeners;
+    std::uint32_t mRevision = 0;
+    
+    void notify(int tile, NavigationChange change);
+};
+
+#endif // NAVIGATION_GRID_H
@@ -0,0 +1,72 @@
+#ifndef PATH_CACHE_H
+#define PATH_CACHE_H
+
+#include "NavigationGrid.h"
+#include "MovementCosts.h"
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+// Long routes that have already been planned, keyed by the region they start
+// in, their goal and the movement costs of the unit. The same trips, between
+// cities or from a base to the front, are ordered over and over, and any
+// unit starting in the same region can follow the same waypoints. Least
+// recently used routes are dropped past MAX_ROUTES.
+//
+// Each route also records the tiles it walks through, and listening to the
+// NavigationGrid, a terrain or building change on one of them drops just
+// the routes using that tile. Units come and go too often to be worth it;
+// the planner walking the route steps around them.
+class PathCache {
+public:
+    static constexpr std::size_t MAX_ROUTES = 256;
+    
+    // Cached waypoints, or nullptr. Counts a hit or a miss.
+    const std::vector<int>* find(const NavigationGrid& grid, int region, int goal, const MovementCosts& costs);
+    
+    // Remember a route and the tiles it walks through
+    void insert(const NavigationGrid& grid, int region, int goal, const MovementCosts& costs,
+                const std::vector<int>& waypoints, const std::vector<int>& tiles);
+    
+    // Pass NavigationGrid changes here
+    void onTileChanged(int tile, NavigationChange change);
+    
+    void clear();
+    
+    std::size_t getRouteCount() const { return mRoutes.size(); }
+    
+    // Lookups since the cache was created, and routes dropped by changes
+    std::size_t getHits() const { return mHits; }
+    std::size_t getMisses() const { return mMisses; }
+    std::size_t getInvalidations() const { return mInvalidations; }
+    
+private:
+    struct Entry {
+        std::uint64_t key;
+        std::vector<int> waypoints;
+        std::vector<int> tiles;
+    };
+    
+    // Most recently used first
+    std::list<Entry> mRoutes;
+    std::unordered_map<std::uint64_t, std::list<Entry>::iterator> mIndex;
+    
+    // Keys of the routes walking through each tile
+    std::unordered_map<int, std::vector<std::uint64_t>> mUsers;
+    
+    std::uint32_t mRevision = 0;
+    std::size_t mHits = 0;
+    std::size_t mMisses = 0;
+    std::size_t mInvalidations = 0;
+    
+    static std::uint64_t makeKey(int region, int goal, const MovementCosts& costs);
+    
+    // Forget everything once the grid has been rebuilt
+    void checkRevision(const NavigationGrid& grid);
+    
+    // Drop a route and its entries in mUsers
+    void erase(std::list<Entry>::iterator it);
+};
+
+#endif // PATH_CACHE_H
@@ -0,0 +1,82 @@
+#ifndef PATH_REQUEST_SERVICE_H
+#define PATH_REQUEST_SERVICE_H
+
+#include "NavigationGrid.h"
+#include "HierarchicalPathfinder.h"
+#include <SFML/System.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// A long route a unit wants, solved with the cluster graph for its movement costs
+struct PathRequest {
+    std::uint32_t unit;
+    int start;
+    int goal;
+    HierarchicalPathfinder* hierarchy;
+};
+
+struct PathResult {
+    std::uint32_t unit;
+    int start;
+    int goal;
+    bool found = false;
+    std::vector<int> waypoints;     // As from HierarchicalPathfinder::findWaypoints
+    std::vector<int> tiles;         // Tiles the route walks through
+    const HierarchicalPathfinder* hierarchy = nullptr;
+};
+
+// Solves route requests on a pool of worker threads so the tick that asks
+// for a route never waits for it. Requests submitted during a tick go out as
+// one batch at the next tick boundary, together with a copy of the grid as
+// it was then; workers only read that frame and the cluster graphs, which
+// are brought up to date before the batch starts and left alone until it
+// is done. Results come back at a later tick boundary, applied in order
+// until that tick's time budget is spent.
+class PathRequestService {
+public:
+    // No worker count means one per core not taken by the game and render threads
+    explicit PathRequestService(unsigned workerCount = 0);
+    ~PathRequestService();
+    
+    PathRequestService(const PathRequestService&) = delete;
+    PathRequestService& operator=(const PathRequestService&) = delete;
+    
+    void submit(const PathRequest& request);
+    
+    // Call once per tick: apply finished results until the budget runs out,
+    // then start the next batch if the workers are free
+    void update(const NavigationGrid& grid, sf::Time budget, const std::function<void(const PathResult&)>& apply);
+    
+    // Requests submitted but not yet applied, and results applied so far, for telemetry
+    std::size_t getPendingCount() const;
+    std::size_t getCompletedCount() const { return mCompleted; }
+    
+    unsigned getWorkerCount() const { return static_cast<unsigned>(mWorkers.size()); }
+    
+private:
+    std::vector<std::thread> mWorkers;
+    
+    // Game thread only
+    std::vector<PathRequest> mQueued;
+    std::vector<PathResult> mReady;
+    std::size_t mReadyHead = 0;         // First result in mReady not yet applied
+    std::size_t mCompleted = 0;
+    NavigationGrid mFrame;
+    
+    // Shared with the workers, under mMutex
+    mutable std::mutex mMutex;
+    std::condition_variable mWake;
+    std::vector<PathRequest> mBatch;
+    std::size_t mNextRequest = 0;
+    std::size_t mInFlight = 0;
+    std::vector<PathResult> mFinished;
+    bool mStopping = false;
+    
+    void run();
+};
+
+#endif // PATH_REQUEST_SERVICE_H
@@ -0,0 +1,52 @@
+#ifndef PATHFINDER_H
+#define PATHFINDER_H
+
+#include "NavigationGrid.h"
+#include "MovementCosts.h"
+#include "LandmarkTable.h"
+#include <cstdint>
+#include <vector>
+
+// A* over a NavigationGrid. Per-tile search state lives in flat arrays that
+// are stamped with a search number instead of being cleared, and the open
+// list is a binary heap in a reused vector, so once the buffers have grown
+// to the map size a query allocates nothing.
+//
+// A tile can be entered when the unit's movement costs allow its terrain, no
+// other unit stands on it, and no other faction's building holds it. The goal
+// may hold a building: whether it can be taken is decided when moving there.
+// One Pathfinder serves one thread.
+class Pathfinder {
+public:
+    // Find the cheapest path from start to goal. On success the path holds
+    // the tiles to walk through, start excluded, goal included. Landmarks
+    // built for the same costs tighten the heuristic.
+    bool findPath(const NavigationGrid& grid, int start, int goal, const MovementCosts& costs,
+                  Allegiance faction, std::vector<int>& path, const LandmarkTable* landmarks = nullptr);
+    
+    // Cost of the last path found
+    int getPathCost() const { return mPathCost; }
+    
+    // Tiles taken off the open list by the last search
+    int getNodesExpanded() const { return mNodesExpanded; }
+    
+private:
+    struct OpenNode {
+        int priority;   // Cost so far plus heuristic
+        int cost;       // Cost so far, to skip stale heap entries
+        int tile;
+    };
+    
+    std::vector<int> mCost;             // Best known cost per tile, valid when mSearchOf matches
+    std::vector<int> mParent;
+    std::vector<std::uint32_t> mSearchOf;
+    std::vector<OpenNode> mOpen;
+    std::uint32_t mSearch = 0;
+    int mPathCost = 0;
+    int mNodesExpanded = 0;
+    
+    // Size the per-tile buffers and start a new search number
+    void beginSearch(int tileCount);
+};
+
+#endif // PATHFINDER_H
@@ -0,0 +1,70 @@
+#ifndef RESERVATION_TABLE_H
+#define RESERVATION_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Space-time reservations for cooperative movement: which unit will be on
+// which tile at each of the next HORIZON move steps. A ring of HORIZON
+// buckets, one per step; each bucket is an open-addressed hash table from
+// tile to owner, sized so every agent can hold a tile in every step at half
+// load. Moving time forward just empties the buckets of steps now past.
+//
+// Owners are entity ids; 0 is never a valid id and marks a free tile.
+class ReservationTable {
+public:
+    // Move steps ahead that can be reserved, the current one included
+    static constexpr int HORIZON = 32;
+    static constexpr std::uint32_t NO_OWNER = 0;
+    
+    explicit ReservationTable(std::size_t maxAgents = 2048);
+    
+    // Make step the current one, dropping every reservation before it
+    void advanceTo(std::uint64_t step);
+    std::uint64_t getStep() const { return mStep; }
+    
+    // Whether a step is inside the reservable window
+    bool inWindow(std::uint64_t step) const { return step >= mStep && step < mStep + HORIZON; }
+    
+    // Claim a tile for a step; false if another owner has it, the step is
+    // outside the window, or the step's bucket is full
+    bool reserve(int tile, std::uint64_t step, std::uint32_t owner);
+    
+    // Give back a tile, if this owner holds it
+    void release(int tile, std::uint64_t step, std::uint32_t owner);
+    
+    // Owner of a tile at a step, NO_OWNER if free or outside the window
+    std::uint32_t getOwner(int tile, std::uint64_t step) const;
+    
+    bool isReservedByOther(int tile, std::uint64_t step, std::uint32_t owner) const {
+        std::uint32_t holder = getOwner(tile, step);
+        return holder != NO_OWNER && holder != owner;
+    }
+    
+    // Reservations held across the whole window
+    std::size_t getReservationCount() const;
+    
+private:
+    struct Slot {
+        std::int32_t tile = -1;     // -1 for an empty slot
+        std::uint32_t owner = NO_OWNER;
+    };
+    
+    std::size_t mBucketSize;        // Slots per step, a power of two
+    std::vector<Slot> mSlots;       // HORIZON buckets back to back, bucket = step % HORIZON
+    std::vector<std::uint32_t> mBucketCounts;
+    std::uint64_t mStep = 0;
+    
+    Slot* bucketFor(std::uint64_t step) { return &mSlots[(step % HORIZON) * mBucketSize]; }
+    const Slot* bucketFor(std::uint64_t step) const { return &mSlots[(step % HORIZON) * mBucketSize]; }
+    
+    std::size_t slotFor(int tile) const {
+        // Fibonacci hashing; tiles next to each other spread over the bucket
+        return static_cast<std::size_t>((static_cast<std::uint32_t>(tile) * 2654435769u) & (mBucketSize - 1));
+    }
+    
+    void clearBucket(std::uint64_t step);
+};
+
+#endif // RESERVATION_TABLE_H
@@ -0,0 +1,81 @@
+#ifndef COLLISION_GRID_H
+#define COLLISION_GRID_H
+
+#include "Allegiance.h"
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// Broad phase for projectile hits. Targets are bucketed into a uniform grid
+// of square cells laid over them; each one is entered into every cell its
+// hit box, grown by the reach, overlaps. A box no more than reach from its
+// center can then only touch targets filed under the cells its center passes
+// through, so a projectile's whole step is resolved by walking the cells
+// along the segment it moved and testing just their targets.
+//
+// Rebuilt from scratch whenever targets move. Cells are stored as one flat
+// list sorted by cell, so after the first build nothing allocates unless the
+// target count grows.
+class CollisionGrid {
+public:
+    static constexpr std::uint32_t NO_TARGET = UINT32_MAX;
+
+    // The first target a swept box touches
+    struct Hit {
+        std::uint32_t target = NO_TARGET;
+        float time = 1.0f;          // Fraction of the step, 0 at its start
+    };
+
+    CollisionGrid(float cellSize, float reach);
+
+    // Drop every target
+    void begin();
+
+    // Targets are numbered in the order they are added
+    std::uint32_t add(const sf::FloatRect& bounds, Allegiance allegiance);
+
+    // Lay the cells over the added targets and bucket them; call before querying
+    void build();
+
+    // Stop reporting a target, e.g. once it is destroyed
+    void remove(std::uint32_t target) { mAlive[target] = 0; }
+
+    // First live target of another allegiance touched by a square box of the
+    // given half size moving from one point to another. Targets touched at
+    // the same time go to the lowest-numbered one. halfSize must not exceed
+    // reach. Cost grows with the cells crossed, not with the distance.
+    Hit findFirstHit(const sf::Vector2f& from, const sf::Vector2f& to, float halfSize,
+                     Allegiance allegiance) const;
+
+    std::size_t getTargetCount() const { return mBounds.size(); }
+    float getCellSize() const { return mCellSize; }
+    float getReach() const { return mReach; }
+
+    // Narrow-phase sweep tests run by findFirstHit since the last begin()
+    std::size_t getTestCount() const { return mTests; }
+
+private:
+    float mCellSize;
+    float mReach;
+
+    // Cell layout, covering every grown target box
+    sf::Vector2f mOrigin;
+    int mColumns = 0;
+    int mRows = 0;
+
+    // Per target
+    std::vector<sf::FloatRect> mBounds;
+    std::vector<Allegiance> mAllegiance;
+    std::vector<std::uint8_t> mAlive;
+
+    // Targets of cell c are mCellTargets[mCellStart[c], mCellStart[c + 1])
+    std::vector<std::uint32_t> mCellStart;
+    std::vector<std::uint32_t> mCellTargets;
+
+    mutable std::size_t mTests = 0;
+
+    int getColumn(float x) const;
+    int getRow(float y) const;
+};
+
+#endif // COLLISION_GRID_H
@@ -0,0 +1,81 @@
+#ifndef PROJECTILE_POOL_H
+#define PROJECTILE_POOL_H
+
+#include "ProjectileStats.h"
+#include "Allegiance.h"
+#include "graphics/RenderSnapshot.h"
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// A projectile about to be fired, as the shooter describes it
+struct ProjectileShot {
+    ProjectileType type;
+    sf::Vector2f position;
+    sf::Vector2f direction;     // Unit length; the type sets the speed
+    Allegiance allegiance;
+};
+
+// Every projectile in flight. Projectiles are plain values in fixed-capacity
+// structure-of-arrays storage allocated once up front, so firing, moving and
+// removing them never touch the heap. Live projectiles are packed at the
+// front of every array; the slots past them are the free list, and a removed
+// projectile hands its slot back by swapping the last live one into it.
+class ProjectilePool {
+public:
+    static constexpr std::size_t CAPACITY = 16384;
+
+    ProjectilePool();
+
+    // Shared sprite per type, loaded once; without it projectiles draw as flat quads
+    void loadTextures();
+
+    // Returns false if the type can't be fired or the pool is full
+    bool spawn(const ProjectileShot& shot);
+
+    // Move every projectile by its velocity over deltaTime seconds and drop
+    // the ones past their lifetime
+    void update(float deltaTime);
+
+    // Remove projectile i; the last live projectile takes its index
+    void kill(std::size_t index);
+
+    void clear() { mCount = 0; }
+
+    std::size_t getActiveCount() const { return mCount; }
+    std::size_t getDroppedCount() const { return mDropped; }
+
+    sf::Vector2f getPosition(std::size_t index) const { return {mPositionX[index], mPositionY[index]}; }
+    
+    // Where the projectile was before the last update; the step it swept runs from here to getPosition
+    sf::Vector2f getPreviousPosition(std::size_t index) const { return {mPreviousX[index], mPreviousY[index]}; }
+    ProjectileType getType(std::size_t index) const { return mType[index]; }
+    int getDamage(std::size_t index) const { return mDamage[index]; }
+    Allegiance getAllegiance(std::size_t index) const { return mAllegiance[index]; }
+
+    // Half the edge of the square hit box, centered on the position
+    float getHalfSize(std::size_t index) const { return projectileStatsOf(mType[index]).size / 2.0f; }
+
+    // One quad per projectile, textured if asSprite and the type's texture loaded
+    void captureRenderState(std::vector<SpriteCommand>& sprites, bool asSprite) const;
+
+private:
+    // Structure of arrays, CAPACITY entries each, [0, mCount) live
+    std::vector<float> mPositionX;
+    std::vector<float> mPositionY;
+    std::vector<float> mPreviousX;
+    std::vector<float> mPreviousY;
+    std::vector<float> mVelocityX;      // World units per second
+    std::vector<float> mVelocityY;
+    std::vector<int> mDamage;
+    std::vector<float> mLifetime;       // Seconds left
+    std::vector<Allegiance> mAllegiance;
+    std::vector<ProjectileType> mType;
+    std::size_t mCount = 0;
+    std::size_t mDropped = 0;           // Shots lost to a full pool
+
+    std::array<const sf::Texture*, PROJECTILE_TYPE_COUNT> mTextures{};
+};
+
+#endif // PROJECTILE_POOL_H
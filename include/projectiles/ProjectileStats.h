@@ -0,0 +1,48 @@
+#ifndef PROJECTILE_STATS_H
+#define PROJECTILE_STATS_H
+
+#include "ProjectileType.h"
+#include <SFML/Graphics.hpp>
+#include <array>
+
+// How a kind of projectile flies, hits and looks. Every projectile reads its
+// behaviour from the table below by type, so there is nothing to override.
+struct ProjectileStats {
+    float speed;            // World units per second
+    int damage;
+    float size;             // Edge length of the hit box and the sprite
+    float lifetime;         // Seconds before a projectile that hit nothing expires
+    sf::Color color;        // Flat quad, and fallback shape when the texture is missing
+    const char* texture;    // nullptr: this type can't be fired
+};
+
+constexpr int PROJECTILE_TYPE_COUNT = 5;
+
+// Indexed by ProjectileType
+constexpr std::array<ProjectileStats, PROJECTILE_TYPE_COUNT> PROJECTILE_STATS = {{
+    // NONE
+    {0.0f, 0, 0.0f, 0.0f, sf::Color(0, 0, 0), nullptr},
+    // BULLET
+    {60.0f, 20, 30.0f, 15.0f, sf::Color(255, 255, 0), "assets/images/projectiles/bullet.png"},
+    // ARROW, not fired by anything yet
+    {0.0f, 0, 0.0f, 0.0f, sf::Color(0, 0, 0), nullptr},
+    // ROCKET, not fired by anything yet
+    {0.0f, 0, 0.0f, 0.0f, sf::Color(0, 0, 0), nullptr},
+    // TANK_AMMO: slower than a bullet, hits harder and is drawn larger
+    {42.0f, 50, 50.0f, 20.0f, sf::Color(255, 165, 0), "assets/images/projectiles/tank_ammo.png"}
+}};
+
+constexpr const ProjectileStats& projectileStatsOf(ProjectileType type) {
+    return PROJECTILE_STATS[static_cast<int>(type)];
+}
+
+// Largest hit box of any type; collision lookups are sized from it
+constexpr float maxProjectileSize() {
+    float size = 0.0f;
+    for (const ProjectileStats& stats : PROJECTILE_STATS) {
+        size = stats.size > size ? stats.size : size;
+    }
+    return size;
+}
+
+#endif // PROJECTILE_STATS_H
@@ -24,9 +24,6 @@ public:
     int getVisibilityRange() const { return mVisibilityRange; }
     void setVisibilityRange(int range) { mVisibilityRange = range; }
     
-    // Sprite access for rendering
-    const sf::Sprite* getSprite() const { return mSprite.get(); }
-    
     // Method to load a texture from a file path
     bool loadTexture(const std::string& path);
     
@@ -39,10 +36,7 @@ protected:
     
     // Override the render implementation if needed
     void doRender(sf::RenderWindow& window) const override;
-    
-    // Image and sprite handling
-    sf::Texture mTexture;
-    std::unique_ptr<sf::Sprite> mSprite;
+    void doCaptureRenderState(std::vector<SpriteCommand>& sprites, RenderLayer layer) const override;
 };
 
 #endif // RESOURCE_H 
\ No newline at end of file
@@ -5,7 +5,7 @@
 #include <limits>
 #include "../include/buildings/ResidentialArea.h"
 City::City(std::vector<Hexagon*> cityHexes, Allegiance allegiance) 
-    : cityHexes(cityHexes), mAllegiance(allegiance)
+    : cityHexes(cityHexes), mAllegiance(allegiance), mId(GameObject::allocateId())
 {
     generateBuildings();
 }
@@ -15,13 +15,21 @@
 #include <limits>
 #include <vector>
 
+namespace {
+    // Tint of the tiles a selected unit can reach this turn
+    const sf::Color MOVE_RANGE_COLOR(0, 255, 0, 90);
+}
+
 Game::Game() 
     : mWindow(sf::VideoMode({1200, 800}), "Hexagonal Grid - WASD to move, Q/R to highlight axes"), 
       mDeltaTime(0.f),
       mCamera(sf::Vector2f(0.f, 0.f), sf::Vector2f(1200.f, 800.f)),
       mCameraPosition(0.f, 0.f),
       mInputHandler(mWindow),
-      mRenderer(mWindow),
+      mRenderBackend(mWindow),
+      mRenderer(mRenderBackend),
+      mRenderThread(mWindow, mRenderer),
+      mFrameGovernor(sf::seconds(TICK_SECONDS)),
       mGrid(20), // Create a larger grid with radius 20
       mSelectedCoord(0, 0, 0),
       mHasSelection(false),
@@ -62,17 +70,6 @@ Game::Game()
     mInternationalMarkets = InternationalMarkets();
     mGovernment = Government();
     
-    // Initialize font for UI text
-    if (!mFont.openFromFile("assets/fonts/arial.ttf")) {
-        // Fallback to default system font if asset not found
-        std::cerr << "Warning: Could not load font from assets/fonts/arial.ttf" << std::endl;
-    } else {
-        // Create the text object with the loaded font - font parameter must be first
-        mGovDataText.emplace(mFont, "", 16);
-        mGovDataText->setFillColor(sf::Color::White);
-        mGovDataText->setPosition({10.f, 10.f});
-    }
-    
     // Transfer characters from GridFiller to Game
     auto charactersVector = gridFiller.getCharacters();
     for (auto& character : charactersVector) {
@@ -81,6 +78,51 @@ Game::Game()
     
     mSelectedCharacter = nullptr;
     
+    // One shared sprite per projectile type, loaded before the first shot
+    mProjectiles.loadTextures();
+    
+    mNavigation.build(mGrid);
+    mNavigation.addListener([this](int tile, NavigationChange change) {
+        mFlowFields.onTileChanged(mNavigation, tile, change);
+        mPathCache.onTileChanged(tile, change);
+        for (auto& hierarchy : mHierarchies) {
+            hierarchy->onTileChanged(tile, change);
+        }
+        for (auto& landmarks : mLandmarks) {
+            landmarks->onTileChanged(tile, change);
+        }
+    });
+    
+    // Buildings and cities never move: find them once and register them as
+    // static observers. Every standalone building also sits on a hex.
+    for (const auto& hex : mGrid.getAllHexes()) {
+        if (hex->hasBuilding()) {
+            registerBuilding(hex->getBuilding(), hex->getCoord());
+        }
+    }
+    for (const auto& building : mBuildings) {
+        registerBuilding(building.get(), mGrid.pixelToCube(building->getPosition()));
+    }
+    for (const auto& city : mCities) {
+        mVisibilitySystem.addStaticObserver(city->getId(), city->getAllegiance(),
+                                            mGrid.getTileIndex(mGrid.pixelToCube(city->getPosition())),
+                                            VisibilitySystem::CITY_VISIBILITY_RANGE);
+    }
+    
+    // Cluster graphs and landmarks for every kind of unit on the map are built with the world
+    for (const auto& character : mCharacters) {
+        MovementCosts costs = character->getMovementCosts();
+        getHierarchy(costs);
+        if (!findLandmarks(costs)) {
+            mLandmarks.push_back(std::make_unique<LandmarkTable>(costs));
+            mLandmarks.back()->build(mNavigation);
+        }
+    }
+    
+    // Register every observer once; after this visibility only changes
+    // when something moves, appears or dies
+    updateVisibility();
+    
     // Find a friendly soldier to center the view on
     Hexagon* startHex = nullptr;
     for (const auto& character : mCharacters) {
@@ -95,8 +137,6 @@ Game::Game()
     if (startHex) {
         mCameraPosition = startHex->getPosition();
         mCamera.setCenter(mCameraPosition);
-        mWindow.setView(mCamera);
-        mRenderer.setView(mCamera);
     }
     
     // No need to call generateCityHexesPositions() anymore since GridFiller handles it
@@ -125,11 +165,19 @@ Game::Game()
 
 // Add destructor to clean up memory
 Game::~Game() {
+    // The render thread must be gone before the window and game state it reads
+    mRenderThread.stop();
     // Smart pointers automatically clean up mSoldier and mCities
-    // No explicit cleanup needed
 }
 
 void Game::run() {
+    // Hand the window's GL context over to the render thread; this thread
+    // keeps event handling and the simulation
+    if (!mWindow.setActive(false)) {
+        std::cerr << "Warning: Could not release the window context for the render thread" << std::endl;
+    }
+    mRenderThread.start();
+    
     while (mWindow.isOpen()) {
         mDeltaTime = mClock.restart().asSeconds();
         
@@ -139,9 +187,30 @@ void Game::run() {
         // Update camera based on input
         updateCamera(mInputHandler.getCameraMovement(mDeltaTime));
         
+        sf::Clock updateClock;
         update();
         render();
+        
+        // Feed the governor this tick's simulation cost and the latest render cost
+        mFrameGovernor.recordUpdateTime(updateClock.getElapsedTime());
+        mFrameGovernor.recordRenderTime(mRenderThread.getLastRenderTime());
+        mFrameGovernor.endFrame();
+        ++mTick;
+        
+        // Display no longer paces this loop, so hold the simulation at a fixed tick rate
+        sf::Time elapsed = mClock.getElapsedTime();
+        if (elapsed < sf::seconds(TICK_SECONDS)) {
+            sf::sleep(sf::seconds(TICK_SECONDS) - elapsed);
+        }
     }
+    
+    mRenderThread.stop();
+}
+
+void Game::onClose() {
+    // Stop drawing before the window goes away
+    mRenderThread.stop();
+    mWindow.close();
 }
 
 void Game::onLeftClick(const sf::Vector2f& worldPos) {
@@ -160,6 +229,7 @@ void Game::onLeftClick(const sf::Vector2f& worldPos) {
 
     if (mHasSelection) {
         mGrid.resetHighlights();
+        mRangeOverlay.clear();
         mHasSelection = false;
         mCurrentAxis = HighlightAxis::None;
         mSelectedCharacter = std::nullopt;
@@ -169,6 +239,7 @@ void Game::onLeftClick(const sf::Vector2f& worldPos) {
     Hexagon* hex = mGrid.getHexAtPixel(worldPos);
     if (hex) {
         mGrid.resetHighlights();
+        mRangeOverlay.clear();
         mSelectedCoord = hex->getCoord();
         mHasSelection = true;
         
@@ -179,20 +250,15 @@ void Game::onLeftClick(const sf::Vector2f& worldPos) {
             // Highlight character hex in yellow
             hex->highlight(sf::Color::Yellow);
             
-            // Different behavior based on character type and allegiance
-            
-                // Only show movement options for friendly soldiers
-                if (character->getAllegiance() == Allegiance::FRIENDLY) {
-                    // Debug which terrain types are traversable for this character
-                    std::cout << "Character's traversable terrain types: ";
-                    for (const auto& terrainType : character->getTraversableTerrain()) {
-                        std::cout << static_cast<int>(terrainType) << " ";
-                    }
-                    std::cout << std::endl;
-                    
-                    // Highlight only hexes that are both adjacent and have traversable terrain
-                    mGrid.highlightAdjacentHexes(hex->getCoord(), sf::Color::Green, character->getTraversableTerrain());
-                }
+            // Only show movement options for friendly units
+            if (character->getAllegiance() == Allegiance::FRIENDLY) {
+                // Everything reachable with this turn's move points, in one overlay
+                mMovementRange.compute(mNavigation, hex->getIndex(),
+                                       character->getSpeed() * MovementCosts::POINTS_PER_SPEED,
+                                       character->getMovementCosts(),
+                                       character->getAllegiance());
+                mRangeOverlay.setTiles(mGrid, mMovementRange.getTiles(), MOVE_RANGE_COLOR);
+            }
             
             
             // Set the character as selected
@@ -243,6 +309,17 @@ void Game::onLeftClick(const sf::Vector2f& worldPos) {
 void Game::onRightClick(const sf::Vector2f& worldPos) {
     // Get the hex at the clicked position
     Hexagon* hex = mGrid.getHexAtPixel(worldPos);
+    
+    // Shift-right-click sends the whole army
+    if (hex && sf::Keyboard::isKeyPressed(sf::Keyboard::Key::LShift)) {
+        orderGroupMove(hex);
+        mGrid.resetHighlights();
+        mRangeOverlay.clear();
+        mHasSelection = false;
+        mCurrentAxis = HighlightAxis::None;
+        return;
+    }
+    
     if (hex && mSelectedCharacter.has_value()) {
         // Check if the selected character is friendly - only allow moving friendly soldiers
         if (mSelectedCharacter.value()->getAllegiance() != Allegiance::FRIENDLY) {
@@ -253,14 +330,11 @@ void Game::onRightClick(const sf::Vector2f& worldPos) {
         // Get the character from the clicked hex
         Character* character = hex->getCharacter();
         if (!character) {
-            // Get the source hex for the selected character
-            Hexagon* sourceHex = this->getSourceHex(mSelectedCharacter.value());
-            if (sourceHex && mGrid.areAdjacent(sourceHex->getCoord(), hex->getCoord())) {
-                // Move the selected character to the clicked hex
-                this->moveSelectedCharacter(sourceHex, hex, mSelectedCharacter.value());
-                
+            // Walk the selected character there, however far it is
+            if (orderMove(mSelectedCharacter.value(), hex)) {
                 // Reset highlighting and selection
                 mGrid.resetHighlights();
+                mRangeOverlay.clear();
                 mHasSelection = false;
                 mCurrentAxis = HighlightAxis::None;
             }
@@ -273,48 +347,25 @@ Hexagon* Game::getSourceHex(Character* character) {
     return mGrid.getHexAt(character->getHexCoord());
 }
 
-void Game::moveSelectedCharacter(Hexagon* source, Hexagon* target, Character* character) {
+bool Game::moveSelectedCharacter(Hexagon* source, Hexagon* target, Character* character) {
     if (mGrid.areAdjacent(source->getCoord(), target->getCoord())) {
         if (target->hasBuilding()) {
             if (target->getBuilding()->getAllegiance() != character->getAllegiance() 
             && target->getBuilding()->getDefenses() > 0) {
-               return;
+               return false;
             }
         }
         if (target->hasCharacter()) {
-            return;
+            return false;
         }
         
-        // Debug output to help diagnose terrain-related issues
         TerrainType targetTerrainType = target->getTerrainType();
-        /*
-        std::cout << "\n=== MOVEMENT DEBUG ===\n";
-        std::cout << "Character type: " << static_cast<int>(character->getType()) << std::endl;
-        std::cout << "Moving from: (" << source->getCoord().q << "," << source->getCoord().r << ") to (" << 
-                     target->getCoord().q << "," << target->getCoord().r << ")" << std::endl;
-        std::cout << "Target hex terrain type: " << static_cast<int>(targetTerrainType) 
-                  << " (0=PLAINS, 1=WATER, 2=FOREST, 3=URBAN)" << std::endl;
-        
-        std::cout << "Character's traversable terrain types: ";
-        for (const auto& terrainType : character->getTraversableTerrain()) {
-            std::cout << static_cast<int>(terrainType) << " ";
-        }
-        std::cout << std::endl;
-        */
         
         // Check if the target hex is traversable
-        bool canTraverse = false;
-        for (const auto& terrainType : character->getTraversableTerrain()) {
-            if (terrainType == target->getTerrainType()) {
-                canTraverse = true;
-                break;
-            }
-        }
-        
-        if (!canTraverse) {
+        if (!character->getMovementCosts().canEnter(targetTerrainType)) {
             // std::cout << "DENIED: Cannot move to this terrain type - not in traversable terrain list" << std::endl;
             // std::cout << "========================\n";
-            return;
+            return false;
         }
         
         // std::cout << "APPROVED: Moving character to new position" << std::endl;
@@ -331,7 +382,323 @@ void Game::moveSelectedCharacter(Hexagon* source, Hexagon* target, Character* ch
         
         // Make sure the character's hex coordinates are updated
         character->setHexCoord(target->getCoord());
+        
+        // Only this observer's disk changes
+        mVisibilitySystem.moveObserver(mGrid, character->getId(), target->getCoord());
+        mNavigation.setUnit(source->getIndex(), false);
+        mNavigation.setUnit(target->getIndex(), true);
         // std::cout << "Character moved to (" << character->getHexCoord().q << "," << character->getHexCoord().r << ")" << std::endl;
+        return true;
+    }
+    return false;
+}
+
+bool Game::orderMove(Character* character, Hexagon* target) {
+    cancelMoveOrder(character->getId());
+    
+    int start = mGrid.getTileIndex(character->getHexCoord());
+    int goal = target->getIndex();
+    MoveOrder& order = mMoveOrders[character->getId()];
+    order.costs = character->getMovementCosts();
+    order.goal = goal;
+    
+    bool planned;
+    if (mNavigation.distance(start, goal) >= HIERARCHICAL_MIN_DISTANCE) {
+        // Known routes are used at once; others are solved off the tick and
+        // the unit sets out when its route comes back
+        HierarchicalPathfinder& hierarchy = getHierarchy(order.costs);
+        if (const std::vector<int>* cached = mPathCache.find(mNavigation, hierarchy.getRegion(start), goal, order.costs)) {
+            order.waypoints = *cached;
+            planned = planSegment(character, order);
+        } else {
+            mPathRequests.submit({character->getId(), start, goal, &hierarchy});
+            order.awaitingRoute = true;
+            planned = true;
+        }
+    } else {
+        // The whole way first, with landmarks, which turns away goals that
+        // can't be reached before any space-time search runs; then walk it
+        // leg by leg, planning around other units as each leg comes up
+        planned = mRoutePlanner.findPath(mNavigation, start, goal, order.costs, character->getAllegiance(),
+                                         mRoute, findLandmarks(order.costs));
+        if (planned) {
+            order.waypoints.clear();
+            for (std::size_t i = ROUTE_LEG_TILES - 1; i + 1 < mRoute.size(); i += ROUTE_LEG_TILES) {
+                order.waypoints.push_back(mRoute[i]);
+            }
+            order.waypoints.push_back(goal);
+            planned = planSegment(character, order);
+        }
+    }
+    
+    if (!planned) {
+        mMoveOrders.erase(character->getId());
+    }
+    return planned;
+}
+
+bool Game::planSegment(Character* character, MoveOrder& order) {
+    releasePath(character->getId(), order);
+    
+    int start = mGrid.getTileIndex(character->getHexCoord());
+    while (order.nextWaypoint < order.waypoints.size()) {
+        if (mPathfinder.findPath(mNavigation, mReservations, start, order.waypoints[order.nextWaypoint],
+                                 order.costs, character->getAllegiance(), character->getId(), order.path,
+                                 nullptr, findLandmarks(order.costs))) {
+            order.origin = start;
+            order.pathStep = mMoveStep + 1;
+            order.next = 0;
+            if (reservePath(character->getId(), order)) {
+                return true;
+            }
+            break;
+        }
+        
+        // Something holds that waypoint or the way to it; aim for the one after
+        ++order.nextWaypoint;
+    }
+    order.path.clear();
+    return false;
+}
+
+bool Game::planFieldWindow(Character* character, MoveOrder& order) {
+    releasePath(character->getId(), order);
+    order.path.clear();
+    
+    // Units with the same goal and movement costs share one field
+    const FlowField& field = mFlowFields.getField(mNavigation, order.goal, order.costs, character->getAllegiance());
+    int start = mGrid.getTileIndex(character->getHexCoord());
+    if (start < 0 || start == order.goal || !field.reaches(start)) {
+        return false;
+    }
+    order.fieldCost = field.getCost(start);
+    order.origin = start;
+    order.pathStep = mMoveStep + 1;
+    order.next = 0;
+    
+    // Step downhill on the field, one tile per move step, which is all most
+    // of a group ever needs
+    int next = field.getNextTile(mNavigation, start);
+    if (next >= 0) {
+        order.path.assign(1, next);
+        if (reservePath(character->getId(), order)) {
+            return true;
+        }
+        order.path.clear();
+    }
+    
+    // Every way downhill is taken or claimed by someone; search the window
+    // around them, with the field as the heuristic
+    if (!mPathfinder.findPath(mNavigation, mReservations, start, order.goal, order.costs,
+                              character->getAllegiance(), character->getId(), order.path, &field)
+        || !reservePath(character->getId(), order)) {
+        order.path.clear();
+        return false;
+    }
+    return true;
+}
+
+bool Game::reservePath(std::uint32_t id, const MoveOrder& order) {
+    if (order.path.empty()) {
+        return true;
+    }
+    
+    bool claimed = mReservations.reserve(order.origin, order.pathStep - 1, id);
+    for (std::size_t i = order.next; claimed && i < order.path.size(); ++i) {
+        claimed = mReservations.reserve(order.path[i], order.pathStep + i, id);
+    }
+    
+    // Keep the last tile until the window runs out; the planner made sure it's free
+    for (std::uint64_t step = order.pathStep + order.path.size(); claimed && mReservations.inWindow(step); ++step) {
+        claimed = mReservations.reserve(order.path.back(), step, id);
+    }
+    
+    // A step taken by someone else, or a full step bucket: walking the rest
+    // unreserved would run into others, so hold none of it
+    if (!claimed) {
+        releasePath(id, order);
+    }
+    return claimed;
+}
+
+void Game::releasePath(std::uint32_t id, const MoveOrder& order) {
+    if (order.path.empty()) {
+        return;
+    }
+    
+    // Steps already past were dropped by the table itself
+    mReservations.release(order.origin, order.pathStep - 1, id);
+    for (std::size_t i = 0; i < order.path.size(); ++i) {
+        mReservations.release(order.path[i], order.pathStep + i, id);
+    }
+    for (std::uint64_t step = order.pathStep + order.path.size(); mReservations.inWindow(step); ++step) {
+        mReservations.release(order.path.back(), step, id);
+    }
+}
+
+void Game::cancelMoveOrder(std::uint32_t id) {
+    auto it = mMoveOrders.find(id);
+    if (it != mMoveOrders.end()) {
+        releasePath(id, it->second);
+        mMoveOrders.erase(it);
+    }
+}
+
+void Game::applyRoute(const PathResult& result) {
+    if (result.found) {
+        mPathCache.insert(mNavigation, result.hierarchy->getRegion(result.start), result.goal,
+                          result.hierarchy->getCosts(), result.waypoints, result.tiles);
+    }
+    
+    // The unit may have died or been given another order meanwhile
+    auto it = mMoveOrders.find(result.unit);
+    if (it == mMoveOrders.end() || !it->second.awaitingRoute || it->second.goal != result.goal) {
+        return;
+    }
+    auto character = std::find_if(mCharacters.begin(), mCharacters.end(),
+        [&result](const std::unique_ptr<Character>& c) { return c->getId() == result.unit; });
+    
+    MoveOrder& order = it->second;
+    order.awaitingRoute = false;
+    order.waypoints = result.waypoints;
+    order.nextWaypoint = 0;
+    if (!result.found || character == mCharacters.end() || !planSegment(character->get(), order)) {
+        cancelMoveOrder(result.unit);
+    }
+}
+
+const LandmarkTable* Game::findLandmarks(const MovementCosts& costs) const {
+    for (const auto& landmarks : mLandmarks) {
+        if (landmarks->getCosts() == costs) {
+            return landmarks.get();
+        }
+    }
+    return nullptr;
+}
+
+HierarchicalPathfinder& Game::getHierarchy(const MovementCosts& costs) {
+    for (auto& hierarchy : mHierarchies) {
+        if (hierarchy->getCosts() == costs) {
+            return *hierarchy;
+        }
+    }
+    mHierarchies.push_back(std::make_unique<HierarchicalPathfinder>(costs));
+    mHierarchies.back()->build(mNavigation);
+    return *mHierarchies.back();
+}
+
+void Game::orderGroupMove(Hexagon* target) {
+    // Units closest to the goal plan first, so the ones behind them plan
+    // around paths that are already reserved instead of the other way round
+    std::vector<std::pair<std::uint32_t, Character*>> group;
+    for (const auto& character : mCharacters) {
+        if (character->getAllegiance() != Allegiance::FRIENDLY) {
+            continue;
+        }
+        cancelMoveOrder(character->getId());
+        
+        MovementCosts costs = character->getMovementCosts();
+        const FlowField& field = mFlowFields.getField(mNavigation, target->getIndex(), costs, character->getAllegiance());
+        int tile = mGrid.getTileIndex(character->getHexCoord());
+        if (tile >= 0 && field.reaches(tile)) {
+            group.emplace_back(field.getCost(tile), character.get());
+        }
+    }
+    std::sort(group.begin(), group.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    
+    for (const auto& member : group) {
+        Character* character = member.second;
+        MoveOrder& order = mMoveOrders[character->getId()];
+        order.followField = true;
+        order.goal = target->getIndex();
+        order.costs = character->getMovementCosts();
+        if (!planFieldWindow(character, order)) {
+            mMoveOrders.erase(character->getId());
+        }
+    }
+}
+
+void Game::updateMoveOrders() {
+    // The clock runs even without orders so reservations of finished paths expire
+    mMoveClock += mDeltaTime;
+    if (mMoveClock < MOVE_STEP_SECONDS) {
+        return;
+    }
+    mMoveClock -= MOVE_STEP_SECONDS;
+    mReservations.advanceTo(++mMoveStep);
+    if (mMoveOrders.empty()) {
+        return;
+    }
+    
+    mStepping.clear();
+    for (const auto& character : mCharacters) {
+        auto it = mMoveOrders.find(character->getId());
+        if (it != mMoveOrders.end() && !it->second.awaitingRoute) {
+            mStepping.push_back(character.get());
+        }
+    }
+    
+    // Take this step's entry of every path. A unit following another onto
+    // the tile it is leaving has to wait for that move, so keep going over
+    // the rest while anyone still gets through.
+    bool progress = true;
+    while (progress && !mStepping.empty()) {
+        progress = false;
+        for (std::size_t i = 0; i < mStepping.size();) {
+            Character* character = mStepping[i];
+            MoveOrder& order = mMoveOrders[character->getId()];
+            Hexagon* source = getSourceHex(character);
+            int target = order.path[order.next];
+            if (source && (source->getIndex() == target
+                           || moveSelectedCharacter(source, mGrid.getTile(target), character))) {
+                ++order.next;
+                order.replanned = false;
+                mStepping[i] = mStepping.back();
+                mStepping.pop_back();
+                progress = true;
+            } else {
+                ++i;
+            }
+        }
+    }
+    
+    // Whatever is left was blocked by something that didn't plan around it;
+    // go around it once, and give up if that is blocked too
+    for (Character* character : mStepping) {
+        MoveOrder& order = mMoveOrders[character->getId()];
+        if (order.replanned
+            || !(order.followField ? planFieldWindow(character, order) : planSegment(character, order))) {
+            cancelMoveOrder(character->getId());
+            continue;
+        }
+        order.replanned = true;
+    }
+    
+    for (const auto& character : mCharacters) {
+        auto it = mMoveOrders.find(character->getId());
+        if (it == mMoveOrders.end() || it->second.awaitingRoute || it->second.next < it->second.path.size()) {
+            continue;
+        }
+        
+        MoveOrder& order = it->second;
+        int tile = mGrid.getTileIndex(character->getHexCoord());
+        bool planned;
+        if (order.followField) {
+            // Arrived, or the last window got no closer: as close as the crowd allows
+            const FlowField* field = mFlowFields.findField(order.goal, order.costs, character->getAllegiance());
+            planned = tile != order.goal && (!field || field->getCost(tile) < order.fieldCost)
+                && planFieldWindow(character.get(), order);
+        } else if (tile == order.waypoints[order.nextWaypoint]) {
+            // Reached a waypoint: plan the next stretch, or stop at the goal
+            planned = ++order.nextWaypoint < order.waypoints.size() && planSegment(character.get(), order);
+        } else {
+            // The window ran out short of the waypoint; carry on unless it got nowhere
+            planned = tile != order.origin && planSegment(character.get(), order);
+        }
+        
+        if (!planned) {
+            cancelMoveOrder(character->getId());
+        }
     }
 }
 
@@ -347,6 +714,7 @@ void Game::onKeyPress(sf::Keyboard::Key key) {
         }
         else if (key == sf::Keyboard::Key::Escape) {
             mGrid.resetHighlights();
+            mRangeOverlay.clear();
             mHasSelection = false;
             mCurrentAxis = HighlightAxis::None;
         }
@@ -356,6 +724,11 @@ void Game::onKeyPress(sf::Keyboard::Key key) {
     if (key == sf::Keyboard::Key::F) {
         toggleFogOfWar();
     }
+    
+    // Grid lines toggle with 'G' key
+    if (key == sf::Keyboard::Key::G) {
+        toggleGridOutlines();
+    }
 }
 
 sf::Vector2f Game::clampCameraPosition(const sf::Vector2f& position) {
@@ -396,92 +769,97 @@ void Game::updateCamera(const sf::Vector2f& movement) {
     // Clamp position to grid bounds
     mCameraPosition = clampCameraPosition(mCameraPosition);
     
-    // Apply the clamped position
+    // Apply the clamped position; the render thread picks it up with the next snapshot
     mCamera.setCenter(mCameraPosition);
-    
-    // Update both the window and renderer views
-    mWindow.setView(mCamera);
-    mRenderer.setView(mCamera);
 }
 
 void Game::update() {
+    // Apply any buildings built or destroyed since the last tick
+    mVisibilitySystem.updateStaticCoverage(mGrid);
+    
     // Update cooldowns for all characters
     for (auto* character : getCharacters()) {
         character->updateCooldowns(mDeltaTime);
     }
     
     generateProducts();
-    // Update visibility for fog of war
-    updateVisibility();
     mNationalAccounts.nextDay();
+    mPathRequests.update(mNavigation, sf::seconds(ROUTE_APPLY_BUDGET_SECONDS),
+                         [this](const PathResult& result) { applyRoute(result); });
+    updateMoveOrders();
     setCharactersTargetPosition();
     moveProjectiles();
+    mParticles.update(mDeltaTime);
+    
+    // Everything that changed visibility since the last tick, input handling
+    // included, has happened by now; start the next tick's list
+    mVisibilitySystem.beginTick();
 }
 
 void Game::render() {
-    mRenderer.clear();
-    
-    // Set fog of war state in renderer
-    mRenderer.setFogOfWarEnabled(mFogOfWarEnabled);
+    RenderSnapshot& snapshot = mRenderThread.beginFrame();
+    snapshot.camera = mCamera;
+    snapshot.fogOfWarEnabled = mFogOfWarEnabled;
+    snapshot.quality.drawOutlines = mFrameGovernor.drawOutlines();
+    snapshot.quality.drawFullFog = mFrameGovernor.drawFullFog();
+    snapshot.gridOutline = mGridOutline;
     
-    // Render the grid (which now handles visibility)
-    mRenderer.render(mGrid);
+    SceneCapture::captureGrid(snapshot, mGrid, mVisibilitySystem);
+    snapshot.tileOverlay = mRangeOverlay.getVertices();
     
-    // Render all characters that are on visible hexes
     for (const auto& character : mCharacters) {
-        // Get the hex at the character's position
-        Hexagon* hex = mGrid.getHexAt(character->getHexCoord());
-        
-        // Only render the character if its hex is visible or fog of war is disabled
-        if (!mFogOfWarEnabled || (hex && hex->isVisible())) {
-            mRenderer.render(*character);
-        }
-    }
-    
-    // Render all projectiles using the GameObject renderer
-    for (const auto& projectile : mProjectiles) {
-        // For projectiles, we could check if they're in visible area
-        // But for gameplay purposes, always show projectiles
-        mRenderer.render(*projectile);
+        SceneCapture::captureCharacter(snapshot, mGrid, *character);
     }
     
-    // Store the current view
-    sf::View currentView = mWindow.getView();
+    // For projectiles, we could check if they're in visible area
+    // But for gameplay purposes, always show projectiles.
+    // Under load they fall back to small flat quads, which batch into one draw
+    SceneCapture::captureProjectiles(snapshot, mProjectiles, mFrameGovernor.drawProjectileSprites());
     
-    // Switch to default view for UI elements
-    mWindow.setView(mWindow.getDefaultView());
+    mParticles.captureRenderState(snapshot.particles);
     
-    // Render the sidebar
-    mSideBar.draw(mWindow);
-    
-    // Render government data on screen
-    renderGovernmentData();
+    // Status bars are only rewritten for entities whose values changed, and
+    // only copied into a snapshot that doesn't hold them yet
+    updateStatusOverlay();
+    if (snapshot.statusBarsRevision != mStatusOverlay.getRevision()) {
+        snapshot.statusBars = mStatusOverlay.getVertices();
+        snapshot.statusBarsRevision = mStatusOverlay.getRevision();
+    }
     
-    // Restore the game view
-    mWindow.setView(currentView);
+    // Capture the sidebar and government data
+    mSideBar.captureRenderState(snapshot.interfaceRects);
+    snapshot.interfaceRevision = mSideBar.getRevision();
+    if (mTick % mFrameGovernor.getHudRefreshInterval() == 0) {
+        mHudData.treasury = mGovernment.getMoney();
+        mHudData.taxRate = mGovernment.getTaxRate();
+        mHudData.interestRate = mGovernment.getInterestRate();
+        mHudData.gdp = mNationalAccounts.getGDP();
+        mHudData.pathsPending = mPathRequests.getPendingCount();
+        mHudData.pathCacheHits = mPathCache.getHits();
+        mHudData.pathCacheLookups = mPathCache.getHits() + mPathCache.getMisses();
+    }
+    mHudData.qualityLevel = mFrameGovernor.getQualityLevel();
+    snapshot.hud = mHudData;
     
-    // Display the rendered frame
-    mRenderer.display();
+    mRenderThread.publishFrame();
 }
 
-void Game::renderGovernmentData() {
-    // Only render if text was successfully created
-    if (!mGovDataText.has_value()) {
-        return;
-    }
-    
-    // Create text to display
-    std::stringstream ss;
-    ss << "Government Data:" << std::endl
-       << "Treasury: $" << mGovernment.getMoney() << std::endl
-       << "Tax Rate: " << (mGovernment.getTaxRate() * 100) << "%" << std::endl
-       << "Interest Rate: " << (mGovernment.getInterestRate() * 100) << "%" << std::endl
-       << "GDP: $" << mNationalAccounts.getGDP();
+void Game::updateStatusOverlay() {
+    mStatusOverlay.beginFrame();
     
-    mGovDataText->setString(ss.str());
+    // Walk the entities with bars, not the map; the tile each one stands on
+    // tells whether it can be seen
+    auto isTileVisible = [this](int tile) {
+        return !mFogOfWarEnabled || (tile >= 0 && mGrid.getTile(tile)->isVisible());
+    };
+    for (std::size_t i = 0; i < mBuildingRegistry.size(); ++i) {
+        mStatusOverlay.updateBuilding(*mBuildingRegistry[i], isTileVisible(mBuildingTiles[i]));
+    }
+    for (const auto& character : mCharacters) {
+        mStatusOverlay.updateCharacter(*character, isTileVisible(mGrid.getTileIndex(character->getHexCoord())));
+    }
     
-    // Draw text directly to window
-    mWindow.draw(*mGovDataText);
+    mStatusOverlay.endFrame();
 }
 
 void Game::highlightAxis(HighlightAxis axis) {
@@ -521,34 +899,23 @@ void Game::highlightAxis(HighlightAxis axis) {
 } 
 
 void Game::updateVisibility() {
-    if (!mFogOfWarEnabled) {
-        // If fog of war is disabled, make everything visible
-        for (auto hex : mGrid.getAllHexes()) {
-            hex->setVisible(true);
-            // No longer setting explored state
-        }
-        return;
-    }
-    
-    // Get all game entities for visibility calculation
+    // Buildings and cities are static observers and already registered
     std::vector<Character*> characters = getCharacters();
-    std::vector<Building*> buildings = getBuildings();
-    std::vector<City*> cities;
-    
-    // Extract raw pointers to cities
-    for (const auto& city : mCities) {
-        cities.push_back(city.get());
-    }
     
-    // Update visibility
-    mVisibilitySystem.updateVisibility(mGrid, characters, buildings, cities);
+    // Sync observers; with fog of war disabled everything stays visible
+    mVisibilitySystem.updateVisibility(mGrid, characters);
+    mVisibilitySystem.setFogOfWarEnabled(mGrid, mFogOfWarEnabled);
 }
 
 void Game::toggleFogOfWar() {
     mFogOfWarEnabled = !mFogOfWarEnabled;
     
     // Update visibility immediately
-    updateVisibility();
+    mVisibilitySystem.setFogOfWarEnabled(mGrid, mFogOfWarEnabled);
+}
+
+void Game::toggleGridOutlines() {
+    mGridOutline.enabled = !mGridOutline.enabled;
 }
 
 std::vector<Character*> Game::getCharacters() const {
@@ -562,27 +929,41 @@ std::vector<Character*> Game::getCharacters() const {
     return characters;
 }
 
-std::vector<Building*> Game::getBuildings() const {
-    std::vector<Building*> buildings;
-    
-    // Search for all buildings in the grid
-    for (const auto& hex : mGrid.getAllHexes()) {
-        if (hex->hasBuilding()) {
-            buildings.push_back(hex->getBuilding());
-        }
+void Game::registerBuilding(Building* building, const Hexagon::CubeCoord& coord) {
+    if (!building || std::find(mBuildingRegistry.begin(), mBuildingRegistry.end(), building) != mBuildingRegistry.end()) {
+        return;
     }
-    
-    // Also add buildings from our list
-    for (const auto& building : mBuildings) {
-        buildings.push_back(building.get());
+    int tile = mGrid.getTileIndex(coord);
+    mBuildingRegistry.push_back(building);
+    mBuildingTiles.push_back(tile);
+    mVisibilitySystem.addStaticObserver(building->getId(), building->getAllegiance(), tile,
+                                        building->getVisibilityRange());
+    if (tile >= 0) {
+        mNavigation.setBuilding(tile, static_cast<std::int8_t>(building->getAllegiance()));
     }
-    
-    return buildings;
+}
+
+void Game::unregisterBuilding(Building* building) {
+    auto it = std::find(mBuildingRegistry.begin(), mBuildingRegistry.end(), building);
+    if (it == mBuildingRegistry.end()) {
+        return;
+    }
+    std::size_t entry = static_cast<std::size_t>(it - mBuildingRegistry.begin());
+    int tile = mBuildingTiles[entry];
+    mBuildingRegistry.erase(it);
+    mBuildingTiles.erase(mBuildingTiles.begin() + entry);
+    if (tile >= 0) {
+        Hexagon* hex = mGrid.getTile(tile);
+        if (hex->getBuilding() == building) {
+            hex->removeBuilding();
+        }
+        mNavigation.setBuilding(tile, NavigationGrid::NO_OWNER);
+    }
+    mVisibilitySystem.removeStaticObserver(building->getId());
 }
 
 void Game::generateProducts() {
-    std::vector<Building*> mBuildings = getBuildings();
-    for (const auto& building : mBuildings) {
+    for (Building* building : getBuildings()) {
         Workplace* workplace = dynamic_cast<Workplace*>(building);
         if (workplace) {
             //std::cout << "Generating product for workplace" << std::endl;
@@ -621,219 +1002,267 @@ void Game::handleSideBarClick(SideBar::CellId cell) {
 }
 
 void Game::setCharactersTargetPosition() {
+    // Under load each character only searches for a new target every few
+    // ticks, staggered by index; it fires at the one it has every tick
+    int interval = mFrameGovernor.getTargetingInterval();
+    std::size_t index = 0;
+    
     for (const auto& character : getCharacters()) {
-        std::vector<Hexagon*> hexesInRange = mGrid.getHexesInRange(character->getHexCoord(), character->getRange());
-        
-        //std::cout << "Character at (" << character->getQ() << "," << character->getR() 
-        //          << ") with range " << character->getRange()
-        //          << " found " << hexesInRange.size() << " hexes in range" << std::endl;
-        
-        // Clear any existing target
-        character->clearTargetPosition();
-        
-        // HIGHEST PRIORITY: Check for ADJACENT enemy characters first
-        Character* adjacentEnemy = nullptr;
-        std::vector<Hexagon::CubeCoord> adjacentHexes = mGrid.getAdjacentHexes(character->getHexCoord());
+        if ((index++ + mTick) % interval == 0) {
+            findTarget(*character);
+        }
         
-        for (const auto& adjacentCoord : adjacentHexes) {
-            Hexagon* adjacentHex = mGrid.getHexAt(adjacentCoord);
-            if (adjacentHex && adjacentHex->hasCharacter()) {
-                Character* targetCharacter = adjacentHex->getCharacter();
-                if (targetCharacter->getAllegiance() != character->getAllegiance()) {
-                    adjacentEnemy = targetCharacter;
-                    //std::cout << "Found ADJACENT enemy at (" << adjacentCoord.q << "," 
-                    //          << adjacentCoord.r << ")" << std::endl;
-                    break; // Found an adjacent enemy, no need to check others
-                }
+        if (character->firesAtTarget()) {
+            std::optional<ProjectileShot> shot = character->shootProjectile();
+            if (shot) {
+                //std::cout << "Shot projectile" << std::endl;
+                mProjectiles.spawn(*shot);
             }
         }
-        
-        // If we found an adjacent enemy, immediately target it with highest priority
-        if (adjacentEnemy) {
-            sf::Vector2f targetPos = Hexagon::cubeToPixel(adjacentEnemy->getHexCoord(), 25.0f);
-            character->setTargetPosition(targetPos);
-            //std::cout << "Setting ADJACENT enemy as target at position: (" 
-            //          << targetPos.x << "," << targetPos.y << ")" << std::endl;
-                    
-            // Try to shoot at the adjacent enemy
-            std::optional<Projectile> projectile = character->shootProjectile();
-            if (projectile) {
-                //std::cout << "Shot projectile at adjacent enemy" << std::endl;
-                mProjectiles.push_back(std::make_unique<Projectile>(std::move(projectile.value())));
+    }
+}
+
+void Game::findTarget(Character& character) {
+    std::vector<Hexagon*> hexesInRange = mGrid.getHexesInRange(character.getHexCoord(), character.getRange());
+    
+    //std::cout << "Character at (" << character.getQ() << "," << character.getR() 
+    //          << ") with range " << character.getRange()
+    //          << " found " << hexesInRange.size() << " hexes in range" << std::endl;
+    
+    // Clear any existing target
+    character.clearTargetPosition();
+    
+    // HIGHEST PRIORITY: Check for ADJACENT enemy characters first
+    Character* adjacentEnemy = nullptr;
+    std::vector<Hexagon::CubeCoord> adjacentHexes = mGrid.getAdjacentHexes(character.getHexCoord());
+    
+    for (const auto& adjacentCoord : adjacentHexes) {
+        Hexagon* adjacentHex = mGrid.getHexAt(adjacentCoord);
+        if (adjacentHex && adjacentHex->hasCharacter()) {
+            Character* targetCharacter = adjacentHex->getCharacter();
+            if (targetCharacter->getAllegiance() != character.getAllegiance()) {
+                adjacentEnemy = targetCharacter;
+                //std::cout << "Found ADJACENT enemy at (" << adjacentCoord.q << "," 
+                //          << adjacentCoord.r << ")" << std::endl;
+                break; // Found an adjacent enemy, no need to check others
             }
-            continue; // Skip the rest of the targeting logic
         }
-        
-        // If no adjacent enemies, then proceed with the original targeting logic
-        // First try to find the closest enemy character in range
-        float closestCharacterDistance = std::numeric_limits<float>::max();
-        Character* closestCharacter = nullptr;
-        
-        int enemyCharactersFound = 0;
-        
-        for (const auto& hex : hexesInRange) {
-            if (hex->hasCharacter()) {
-                Character* targetCharacter = hex->getCharacter();
+    }
+    
+    // If we found an adjacent enemy, immediately target it with highest priority
+    if (adjacentEnemy) {
+        sf::Vector2f targetPos = Hexagon::cubeToPixel(adjacentEnemy->getHexCoord(), 25.0f);
+        character.setTargetPosition(targetPos);
+        //std::cout << "Setting ADJACENT enemy as target at position: (" 
+        //          << targetPos.x << "," << targetPos.y << ")" << std::endl;
+        return; // Skip the rest of the targeting logic
+    }
+    
+    // If no adjacent enemies, then proceed with the original targeting logic
+    // First try to find the closest enemy character in range
+    float closestCharacterDistance = std::numeric_limits<float>::max();
+    Character* closestCharacter = nullptr;
+    
+    int enemyCharactersFound = 0;
+    
+    for (const auto& hex : hexesInRange) {
+        if (hex->hasCharacter()) {
+            Character* targetCharacter = hex->getCharacter();
+            
+            //std::cout << "  Found character at hex (" << hex->getCoord().q << "," << hex->getCoord().r
+            //          << ") with allegiance " << (targetCharacter->getAllegiance() == Allegiance::FRIENDLY ? "FRIENDLY" : "ENEMY")
+            //          << " (our allegiance: " << (character.getAllegiance() == Allegiance::FRIENDLY ? "FRIENDLY" : "ENEMY") << ")" << std::endl;
+            
+            // Check if it's an enemy to our character (don't target friendlies)
+            if (targetCharacter->getAllegiance() != character.getAllegiance()) {
+                enemyCharactersFound++;
                 
-                //std::cout << "  Found character at hex (" << hex->getCoord().q << "," << hex->getCoord().r
-                //          << ") with allegiance " << (targetCharacter->getAllegiance() == Allegiance::FRIENDLY ? "FRIENDLY" : "ENEMY")
-                //          << " (our allegiance: " << (character->getAllegiance() == Allegiance::FRIENDLY ? "FRIENDLY" : "ENEMY") << ")" << std::endl;
+                // Calculate distance
+                float distance = Hexagon::distance(character.getHexCoord(), targetCharacter->getHexCoord());
                 
-                // Check if it's an enemy to our character (don't target friendlies)
-                if (targetCharacter->getAllegiance() != character->getAllegiance()) {
-                    enemyCharactersFound++;
-                    
-                    // Calculate distance
-                    float distance = Hexagon::distance(character->getHexCoord(), targetCharacter->getHexCoord());
-                    
-                    //std::cout << "    Enemy character found at distance " << distance << std::endl;
-                    
-                    if (distance < closestCharacterDistance) {
-                        closestCharacterDistance = distance;
-                        closestCharacter = targetCharacter;
-                        //std::cout << "    This is the closest enemy so far" << std::endl;
-                    }
+                //std::cout << "    Enemy character found at distance " << distance << std::endl;
+                
+                if (distance < closestCharacterDistance) {
+                    closestCharacterDistance = distance;
+                    closestCharacter = targetCharacter;
+                    //std::cout << "    This is the closest enemy so far" << std::endl;
                 }
             }
         }
-        
-        //std::cout << "Found " << enemyCharactersFound << " enemy characters in range" << std::endl;
-        
-        // If we found a character in range, set it as the target
-        if (closestCharacter) {
-            sf::Vector2f targetPos = Hexagon::cubeToPixel(closestCharacter->getHexCoord(), 25.0f);
-            character->setTargetPosition(targetPos);
-            //std::cout << "Setting closest character as target at position: (" 
-            //          << targetPos.x << "," << targetPos.y << ")" << std::endl;
-            continue; // We're done with this character
-        }
-        
-        // If no character was found, look for buildings
-        float closestBuildingDistance = std::numeric_limits<float>::max();
-        Building* closestBuilding = nullptr;
-        
-        int enemyBuildingsFound = 0;
-        
-        for (const auto& hex : hexesInRange) {
-            if (hex->hasBuilding()) {
-                Building* targetBuilding = hex->getBuilding();
+    }
+    
+    //std::cout << "Found " << enemyCharactersFound << " enemy characters in range" << std::endl;
+    
+    // If we found a character in range, set it as the target
+    if (closestCharacter) {
+        sf::Vector2f targetPos = Hexagon::cubeToPixel(closestCharacter->getHexCoord(), 25.0f);
+        // Units further away are only tracked, not fired on
+        character.setTargetPosition(targetPos, false);
+        //std::cout << "Setting closest character as target at position: (" 
+        //          << targetPos.x << "," << targetPos.y << ")" << std::endl;
+        return; // We're done with this character
+    }
+    
+    // If no character was found, look for buildings
+    float closestBuildingDistance = std::numeric_limits<float>::max();
+    Building* closestBuilding = nullptr;
+    
+    int enemyBuildingsFound = 0;
+    
+    for (const auto& hex : hexesInRange) {
+        if (hex->hasBuilding()) {
+            Building* targetBuilding = hex->getBuilding();
+            
+            // Only target buildings of opposing allegiance
+            if (targetBuilding->getAllegiance() != character.getAllegiance()) {
+                enemyBuildingsFound++;
                 
-                // Only target buildings of opposing allegiance
-                if (targetBuilding->getAllegiance() != character->getAllegiance()) {
-                    enemyBuildingsFound++;
-                    
-                    // Calculate distance
-                    float distance = Hexagon::distance(character->getHexCoord(), hex->getCoord());
-                    
-                    if (distance < closestBuildingDistance) {
-                        closestBuildingDistance = distance;
-                        closestBuilding = targetBuilding;
-                    }
+                // Calculate distance
+                float distance = Hexagon::distance(character.getHexCoord(), hex->getCoord());
+                
+                if (distance < closestBuildingDistance) {
+                    closestBuildingDistance = distance;
+                    closestBuilding = targetBuilding;
                 }
             }
         }
-        
-        //std::cout << "Found " << enemyBuildingsFound << " enemy buildings in range" << std::endl;
-        
-        // If we found a building in range, set it as the target
-        if (closestBuilding) {
-            sf::Vector2f targetPos = closestBuilding->getPosition();
-            character->setTargetPosition(targetPos);
-            //std::cout << "Setting building as target at position: (" 
-            //          << targetPos.x << "," << targetPos.y << ")" << std::endl;
-        }
-        
-        // Debug output only if character has a target
-        if (character->hasTarget()) {
-            std::optional<Projectile> projectile = character->shootProjectile();
-            if (projectile) {
-                //std::cout << "Shot projectile" << std::endl;
-                // Store the projectile in our collection
-                // Since Character::shootProjectile already returns the correct projectile type (Bullet)
-                mProjectiles.push_back(std::make_unique<Projectile>(std::move(projectile.value())));
-            }
-            //std::cout << "Character has target at: " << character->getTargetPosition().x << ", " 
-            //          << character->getTargetPosition().y << std::endl;
-        } else {
-            //std::cout << "Character has no target" << std::endl;
-        }
+    }
+    
+    //std::cout << "Found " << enemyBuildingsFound << " enemy buildings in range" << std::endl;
+    
+    // If we found a building in range, set it as the target
+    if (closestBuilding) {
+        sf::Vector2f targetPos = closestBuilding->getPosition();
+        character.setTargetPosition(targetPos);
+        //std::cout << "Setting building as target at position: (" 
+        //          << targetPos.x << "," << targetPos.y << ")" << std::endl;
     }
 }
 
 void Game::moveProjectiles() {
-    // Update all projectiles
-    for (auto it = mProjectiles.begin(); it != mProjectiles.end();) {
-        (*it)->update();
-        // Print projectile position
-        //std::cout << "Projectile position: " << (*it)->getPosition().x << ", " << (*it)->getPosition().y << std::endl;
-        
-        // Check for collisions and get whether to remove the projectile
-        bool removeProjectile = checkCollisions(it->get());
-        
-        // Either remove the projectile or advance to the next one
-        if (removeProjectile) {
-            it = mProjectiles.erase(it); // erase() returns iterator to next element
+    // Move all projectiles; the ones that flew too long without hitting anything expire
+    mProjectiles.update(mDeltaTime);
+    if (mProjectiles.getActiveCount() == 0) {
+        return;
+    }
+    
+    buildCollisionGrid();
+    for (std::size_t i = 0; i < mProjectiles.getActiveCount();) {
+        // A removed projectile's index is taken by the last one, so check it again
+        if (checkCollisions(i)) {
+            mProjectiles.kill(i);
         } else {
-            ++it;
+            ++i;
         }
     }
 }
 
-bool Game::checkCollisions(Projectile* projectile) {
-    // Check if the projectile is colliding with any buildings
-    for (const auto& building : getBuildings()) {
-        if (building->getAllegiance() != projectile->getAllegiance()) {
-            auto intersection = projectile->getBoundingBox().findIntersection(building->getBoundingBox());
-            if (intersection.has_value()) {
-                // Handle collision with the building
-                //std::cout << "Projectile collided with building" << std::endl;
-                building->takeDamage(projectile->getDamage());
-                return true; // Remove projectile
-            }
+void Game::buildCollisionGrid() {
+    // Buildings go in first so they take the hit when a projectile touches a
+    // building and a character at once
+    mCollisionGrid.begin();
+    mCollisionTargets.clear();
+    for (Building* building : getBuildings()) {
+        mCollisionGrid.add(building->getBoundingBox(), building->getAllegiance());
+        mCollisionTargets.push_back({building, nullptr});
+    }
+    for (const auto& character : mCharacters) {
+        mCollisionGrid.add(character->getBoundingBox(), character->getAllegiance());
+        mCollisionTargets.push_back({nullptr, character.get()});
+    }
+    mCollisionGrid.build();
+}
+
+bool Game::checkCollisions(std::size_t projectile) {
+    // Sweep the whole step the projectile just moved, so nothing fast can
+    // pass through a target between ticks
+    sf::Vector2f from = mProjectiles.getPreviousPosition(projectile);
+    sf::Vector2f to = mProjectiles.getPosition(projectile);
+    CollisionGrid::Hit hit = mCollisionGrid.findFirstHit(from, to, mProjectiles.getHalfSize(projectile),
+                                                         mProjectiles.getAllegiance(projectile));
+    if (hit.target == CollisionGrid::NO_TARGET) {
+        return false; // Don't remove the projectile
+    }
+    
+    int damage = mProjectiles.getDamage(projectile);
+    ProjectileType type = mProjectiles.getType(projectile);
+    sf::Vector2f impact = from + (to - from) * hit.time;
+    if (Building* building = mCollisionTargets[hit.target].building) {
+        //std::cout << "Projectile collided with building" << std::endl;
+        building->takeDamage(damage);
+        emitImpact(type, impact, true);
+        
+        // A building with no health left is destroyed and comes off the map
+        if (building->getHealth() <= 0) {
+            mCollisionGrid.remove(hit.target);
+            unregisterBuilding(building);
+            
+            // Standalone buildings are ours to delete; a city keeps its own
+            mBuildings.remove_if([building](const std::unique_ptr<Building>& b) {
+                return b.get() == building;
+            });
         }
+        return true; // Remove projectile
     }
     
-    // Get characters for collision testing
-    auto characters = getCharacters();
+    Character* character = mCollisionTargets[hit.target].character;
+    character->takeDamage(damage);
+    emitImpact(type, impact, false);
+    //std::cout << "Projectile collided with character" << std::endl;
     
-    for (auto character : characters) {
-        if (character->getAllegiance() != projectile->getAllegiance()) {
-            auto intersection = projectile->getBoundingBox().findIntersection(character->getBoundingBox());
-            if (intersection.has_value()) {
-                character->takeDamage(projectile->getDamage());
-                //std::cout << "Projectile collided with character" << std::endl;
-                
-                // Check if the character is dead after taking damage
-                if (character->isDead()) {
-                    //std::cout << "Character died, removing from hex and game" << std::endl;
-                    
-                    // Find the hex containing this character and remove it
-                    Hexagon* hex = mGrid.getHexAt(character->getHexCoord());
-                    if (hex) {
-                        hex->removeCharacter();
-                    }
-                    
-                    // Find and remove the character from our list (which will delete it)
-                    auto it = std::find_if(mCharacters.begin(), mCharacters.end(),
-                        [character](const std::unique_ptr<Character>& c) {
-                            return c.get() == character;
-                        });
-                    
-                    if (it != mCharacters.end()) {
-                        // If this was the selected character, clear the selection
-                        if (mSelectedCharacter.has_value() && mSelectedCharacter.value() == character) {
-                            mSelectedCharacter.reset();
-                        }
-                        
-                        // Erase from the list (which will call the destructor via unique_ptr)
-                        mCharacters.erase(it);
-                    }
-                }
-                
-                return true; // Remove projectile
+    // Check if the character is dead after taking damage
+    if (character->isDead()) {
+        //std::cout << "Character died, removing from hex and game" << std::endl;
+        mCollisionGrid.remove(hit.target);
+        
+        // Find the hex containing this character and remove it
+        Hexagon* hex = mGrid.getHexAt(character->getHexCoord());
+        if (hex) {
+            hex->removeCharacter();
+        }
+        mVisibilitySystem.removeObserver(mGrid, character->getId());
+        mNavigation.setUnit(mGrid.getTileIndex(character->getHexCoord()), false);
+        cancelMoveOrder(character->getId());
+        
+        // Find and remove the character from our list (which will delete it)
+        auto it = std::find_if(mCharacters.begin(), mCharacters.end(),
+            [character](const std::unique_ptr<Character>& c) {
+                return c.get() == character;
+            });
+        
+        if (it != mCharacters.end()) {
+            // If this was the selected character, clear the selection
+            if (mSelectedCharacter.has_value() && mSelectedCharacter.value() == character) {
+                mSelectedCharacter.reset();
+                mRangeOverlay.clear();
             }
+            
+            // Erase from the list (which will call the destructor via unique_ptr)
+            mCharacters.erase(it);
+        }
+    }
+    
+    return true; // Remove projectile
+}
+
+void Game::emitImpact(ProjectileType type, const sf::Vector2f& position, bool hitBuilding) {
+    // Hits the player can't see make no effect; the bursts fade long before
+    // the fog over them could lift
+    if (mFogOfWarEnabled) {
+        const Hexagon* hex = mGrid.getHexAt(mGrid.pixelToCube(position));
+        if (!hex || !hex->isVisibleTo(Allegiance::FRIENDLY)) {
+            return;
         }
     }
     
-    return false; // Don't remove the projectile
-}   
\ No newline at end of file
+    if (type == ProjectileType::TANK_AMMO) {
+        mParticles.emitExplosion(position);
+    } else {
+        mParticles.emitBulletHit(position);
+    }
+    
+    // Debris from the structure itself
+    if (hitBuilding) {
+        mParticles.emitBuildingDamage(position);
+    }
+}
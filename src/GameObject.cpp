@@ -1,13 +1,16 @@
 #include "../include/GameObject.h"
 #include <iostream>
 
+std::uint32_t GameObject::sNextId = 1;
+
 GameObject::GameObject(float xPos, float yPos, Allegiance allegiance)
-    : mXPos(xPos), mYPos(yPos), mAllegiance(allegiance), mTexture(nullptr), mSprite(nullptr) {
+    : mId(allocateId()), mXPos(xPos), mYPos(yPos), mAllegiance(allegiance), mTexture(nullptr), mSprite(nullptr) {
     // Base initialization - no default texture or shape
 }
 
 GameObject::GameObject(GameObject&& other) noexcept
-    : mXPos(other.mXPos),
+    : mId(other.mId),
+      mXPos(other.mXPos),
       mYPos(other.mYPos),
       mAllegiance(other.mAllegiance),
       mImage(std::move(other.mImage)),
@@ -20,6 +23,7 @@ GameObject::GameObject(GameObject&& other) noexcept
 
 GameObject& GameObject::operator=(GameObject&& other) noexcept {
     if (this != &other) {
+        mId = other.mId;
         mXPos = other.mXPos;
         mYPos = other.mYPos;
         mAllegiance = other.mAllegiance;
@@ -62,6 +66,32 @@ void GameObject::doRender(sf::RenderWindow& window) const {
     }
 }
 
+void GameObject::captureRenderState(std::vector<SpriteCommand>& sprites, RenderLayer layer) const {
+    // NVI pattern - call the implementation method
+    doCaptureRenderState(sprites, layer);
+}
+
+void GameObject::doCaptureRenderState(std::vector<SpriteCommand>& sprites, RenderLayer layer) const {
+    // Base implementation - capture the sprite if it exists
+    if (mSprite) {
+        const sf::IntRect& rect = mSprite->getTextureRect();
+        sprites.push_back({
+            &mSprite->getTexture(),
+            rect,
+            sf::Vector2f(static_cast<float>(rect.size.x), static_cast<float>(rect.size.y)),
+            mSprite->getTransform(),
+            mSprite->getColor(),
+            layer
+        });
+    } else if (!TextureManager::getInstance().areTexturesEnabled()) {
+        // Headless: a flat quad where the sprite would be, so the draw is still recorded
+        sf::FloatRect bounds = getBoundingBox();
+        sf::Transform transform;
+        transform.translate(bounds.position);
+        sprites.push_back({nullptr, sf::IntRect(), bounds.size, transform, sf::Color::White, layer});
+    }
+}
+
 bool GameObject::loadTexture(const std::string& path) {
     std::cout << "Attempting to load texture from: " << path << std::endl;
     
@@ -96,6 +126,11 @@ bool GameObject::loadTexture(const std::string& path) {
 }
 
 void GameObject::createShape(sf::Color color, bool isCircle) {
+    // Building the fallback texture needs a GPU too
+    if (!TextureManager::getInstance().areTexturesEnabled()) {
+        return;
+    }
+    
     // Create a fallback texture
     sf::Image fallbackImage;
     fallbackImage = sf::Image(sf::Vector2u(16, 16), sf::Color::Transparent);
@@ -135,9 +170,7 @@ void GameObject::createShape(sf::Color color, bool isCircle) {
     
     // Add texture to manager
     mTexturePath = shapeName;
-    TextureManager::getInstance().getTexture(shapeName); // This will add an empty entry
-    mTexture = TextureManager::getInstance().getTexture(shapeName);
-    *mTexture = texture; // Copy the texture data
+    mTexture = TextureManager::getInstance().addTexture(shapeName, std::move(texture));
     
     // Create sprite using the texture from manager
     mSprite = std::make_unique<sf::Sprite>(*mTexture);
@@ -16,12 +16,14 @@ void InputHandler::processInputs(Game& game, float deltaTime) {
     std::optional<sf::Event> event;
     while ((event = mWindow.pollEvent())) {
         if (event->is<sf::Event::Closed>()) {
-            mWindow.close();
+            game.onClose();
+            return;
         }
         else if (event->is<sf::Event::MouseButtonPressed>()) {
             const auto& mouseEvent = event->getIf<sf::Event::MouseButtonPressed>();
             if (mouseEvent) {
-                sf::Vector2f worldPos = mWindow.mapPixelToCoords({mouseEvent->position.x, mouseEvent->position.y});
+                // Map with the game camera; the window's own view belongs to the render thread
+                sf::Vector2f worldPos = mWindow.mapPixelToCoords({mouseEvent->position.x, mouseEvent->position.y}, game.getCamera());
                 
                 if (mouseEvent->button == sf::Mouse::Button::Left) {
                     // Handle left click
@@ -59,6 +59,15 @@ void Building::doRender(sf::RenderWindow& window) const {
     }
 }
 
+void Building::doCaptureRenderState(std::vector<SpriteCommand>& sprites, RenderLayer layer) const {
+    // Same split as doRender: flat colored square when there is no texture
+    if (!mHasTexture) {
+        sprites.push_back({nullptr, sf::IntRect(), mShape.getSize(), mShape.getTransform(), mShape.getFillColor(), layer});
+    } else {
+        GameObject::doCaptureRenderState(sprites, layer);
+    }
+}
+
 void Building::takeDamage(int damage) {
     // First reduce defenses, then health
     if (defenses > 0) {
@@ -1,8 +1,6 @@
 #include "../../include/characters/Character.h"
 #include <iostream>
 #include <filesystem>
-#include "../../include/projectiles/Bullet.h"
-#include "../../include/projectiles/TankAmmo.h"
 
 Character::Character(int q, int r, Allegiance allegiance) 
     : GameObject(0.0f, 0.0f, allegiance), // Position will be set later
@@ -10,12 +8,7 @@ Character::Character(int q, int r, Allegiance allegiance)
       attackPower(10), defensePower(5), speed(1), range(1),
       mTargetPosition(std::nullopt) {
     // Position will be set externally based on hex coordinates
-    
-    // Initialize with empty traversable terrain
-    // Derived classes should set their own traversable terrain types
-    mTraversableTerrain = { };
-    
-    // std::cout << "Base Character constructor: Created empty traversable terrain list" << std::endl;
+    // Derived classes set their own movement class
 }
 
 void Character::setPosition(const sf::Vector2f& pixelPos) {
@@ -51,6 +44,7 @@ void Character::move(Hexagon* targetHex) {
 
 void Character::resetShootCooldown(int cooldownTime) {
     shootCooldown = cooldownTime;
+    shootCooldownLength = cooldownTime;
 }
 
 void Character::updateCooldowns(float deltaTime) {
@@ -60,7 +54,7 @@ void Character::updateCooldowns(float deltaTime) {
     }
 }
 
-std::optional<Projectile> Character::shootProjectile() {
+std::optional<ProjectileShot> Character::shootProjectile() {
     // Debug all conditions that might prevent shooting
     if (!canShoot()) {
         std::cout << "Cannot shoot: cooldown is " << shootCooldown << std::endl;
@@ -97,48 +91,20 @@ std::optional<Projectile> Character::shootProjectile() {
               << ") to (" << targetPos.x << "," << targetPos.y 
               << ") at distance " << distanceToTarget << std::endl;
     
-    // Special case for very close enemies - adjust the direction slightly to ensure hit
-    if (distanceToTarget < 30.0f) {
-        std::cout << "Target is very close! Adjusting aim to ensure hit." << std::endl;
-        // For close targets, we'll use the exact vector to the target instead of normalizing
-        // This ensures the projectile doesn't overshoot at close range
-        
-        // If the distance is extremely small, give it a minimum length to avoid zero-length vectors
-        if (distanceToTarget < 5.0f) {
-            direction.x = (direction.x == 0) ? 0.1f : direction.x;
-            direction.y = (direction.y == 0) ? 0.1f : direction.y;
-        }
-        
-        // For close targets, don't normalize - use a slower speed to make sure we hit
-        switch (mProjectileType.value()) {
-            case ProjectileType::BULLET:
-                return Bullet(startPos.x, startPos.y, direction.x / 10.0f, direction.y / 10.0f, getAllegiance());
-            case ProjectileType::TANK_AMMO:
-                return TankAmmo(startPos.x, startPos.y, direction.x / 10.0f, direction.y / 10.0f, getAllegiance());
-            default:
-                std::cout << "Unknown projectile type" << std::endl;
-                return std::nullopt;
-        }
-    }
-    
-    // For normal range targets, normalize the direction vector
+    // Hits are swept along the whole step, so even point-blank shots can
+    // fly at full speed without passing through the target
     if (distanceToTarget > 0) {
         direction.x /= distanceToTarget;
         direction.y /= distanceToTarget;
+    } else {
+        // Target on top of us: any direction hits it
+        direction = sf::Vector2f(1.0f, 0.0f);
     }
     
     std::cout << "Character shooting projectile with normalized direction: (" 
               << direction.x << "," << direction.y << ")" << std::endl;
     
-    switch (mProjectileType.value()) {
-        case ProjectileType::BULLET:
-            return Bullet(startPos.x, startPos.y, direction.x, direction.y, getAllegiance());
-        case ProjectileType::TANK_AMMO:
-            return TankAmmo(startPos.x, startPos.y, direction.x, direction.y, getAllegiance());
-        default:
-            std::cout << "Unknown projectile type" << std::endl;
-            return std::nullopt;
-    }
+    return ProjectileShot{mProjectileType.value(), startPos, direction, getAllegiance()};
 }
 
 void Character::takeDamage(int damage) {
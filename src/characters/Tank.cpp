@@ -9,6 +9,7 @@ Tank::Tank(int q, int r) : Character(q, r) {
     setVisibilityRange(TANK_VISIBILITY_RANGE);
     mProjectileType = ProjectileType::TANK_AMMO;
     shootCooldown = 100;  // Longer cooldown for balance
+    shootCooldownLength = 100;
     
     // Set combat properties
     range = 2;  // Tanks can shoot from further away
@@ -17,17 +18,7 @@ Tank::Tank(int q, int r) : Character(q, r) {
     maxHealth = 150;
     
     // Tanks can only traverse plains and urban terrain (not forest or water)
-    mTraversableTerrain.clear();  // Clear default terrains from Character constructor
-    mTraversableTerrain.push_back(TerrainType::PLAINS);
-    mTraversableTerrain.push_back(TerrainType::URBAN);
-    
-    // Debug to verify traversable terrain is set correctly
-    // std::cout << "Tank traversable terrain count: " << mTraversableTerrain.size() << std::endl;
-    // std::cout << "Tank traversable terrain types: ";
-    // for (const auto& terrain : mTraversableTerrain) {
-    //     std::cout << static_cast<int>(terrain) << " ";
-    // }
-    // std::cout << std::endl;
+    mMovementClass = MovementClass::Tracked;
     
     // Debug output to verify initialization
     // std::cout << "Created tank at (" << q << "," << r << ") with range " << range << std::endl;
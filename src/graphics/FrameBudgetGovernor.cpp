@@ -0,0 +1,40 @@
+#include "../../include/graphics/FrameBudgetGovernor.h"
+#include <algorithm>
+
+FrameBudgetGovernor::FrameBudgetGovernor(sf::Time frameBudget)
+    : mBudgetSeconds(frameBudget.asSeconds()) {
+}
+
+void FrameBudgetGovernor::recordUpdateTime(sf::Time time) {
+    float load = time.asSeconds() / mBudgetSeconds;
+    mUpdateLoad += (load - mUpdateLoad) * SMOOTHING;
+}
+
+void FrameBudgetGovernor::recordRenderTime(sf::Time time) {
+    float load = time.asSeconds() / mBudgetSeconds;
+    mRenderLoad += (load - mRenderLoad) * SMOOTHING;
+}
+
+void FrameBudgetGovernor::endFrame() {
+    // Simulation and rendering run on separate threads, so the frame is
+    // only as slow as the slower of the two
+    float load = std::max(mUpdateLoad, mRenderLoad);
+
+    if (load > OVER_BUDGET) {
+        mHeadroomFrames = 0;
+        if (++mOverBudgetFrames >= FRAMES_TO_DEGRADE && mQualityLevel < MAX_QUALITY_LEVEL) {
+            ++mQualityLevel;
+            mOverBudgetFrames = 0;
+        }
+    } else if (load < HEADROOM) {
+        mOverBudgetFrames = 0;
+        if (++mHeadroomFrames >= FRAMES_TO_RESTORE && mQualityLevel > 0) {
+            --mQualityLevel;
+            mHeadroomFrames = 0;
+        }
+    } else {
+        // Inside the hysteresis band, hold the current level
+        mOverBudgetFrames = 0;
+        mHeadroomFrames = 0;
+    }
+}
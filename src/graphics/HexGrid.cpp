@@ -1,11 +1,15 @@
 #include "../../include/graphics/HexGrid.h"
 #include "../../include/graphics/PerlinNoise.h"
+#include <cstdlib>
 #include <limits>
 #include <ctime>
 #include <iostream>
 
 
-HexGrid::HexGrid(int radius) : mRadius(radius) {
+HexGrid::HexGrid(int radius) : HexGrid(radius, static_cast<unsigned int>(std::time(nullptr))) {
+}
+
+HexGrid::HexGrid(int radius, unsigned int seed) : mRadius(radius) {
     // Create hexagons in a spiral pattern from the center
     for (int q = -radius; q <= radius; q++) {
         int r1 = std::max(-radius, -q - radius);
@@ -23,12 +27,42 @@ HexGrid::HexGrid(int radius) : mRadius(radius) {
             mHexagons[cubeCoord]->setPosition(pos);
         }
     }
-    generateTerrain();
+    buildTileIndex();
+    generateTerrain(seed);
+}
+
+void HexGrid::buildTileIndex() {
+    // Number tiles in the same q/r order they were created in
+    for (int q = -mRadius; q <= mRadius; q++) {
+        int r1 = std::max(-mRadius, -q - mRadius);
+        int r2 = std::min(mRadius, -q + mRadius);
+        mColumnStart.push_back(static_cast<int>(mTiles.size()));
+        for (int r = r1; r <= r2; r++) {
+            Hexagon* hex = mHexagons[Hexagon::CubeCoord(q, r, -q - r)].get();
+            hex->setIndex(static_cast<int>(mTiles.size()));
+            mTiles.push_back(hex);
+        }
+    }
+    
+    // Resolve neighbors once, so hot loops don't hash coordinates
+    mNeighbors.resize(mTiles.size());
+    for (Hexagon* hex : mTiles) {
+        for (int direction = 0; direction < 6; ++direction) {
+            mNeighbors[hex->getIndex()][direction] = getTileIndex(Hexagon::neighbor(hex->getCoord(), direction));
+        }
+    }
+}
+
+int HexGrid::getTileIndex(const Hexagon::CubeCoord& coord) const {
+    if (std::abs(coord.q) > mRadius || std::abs(coord.r) > mRadius || std::abs(coord.s) > mRadius) {
+        return -1;
+    }
+    int r1 = std::max(-mRadius, -coord.q - mRadius);
+    return mColumnStart[coord.q + mRadius] + (coord.r - r1);
 }
 
-void HexGrid::generateTerrain() {
+void HexGrid::generateTerrain(unsigned int seed) {
     // Use PerlinNoise or SimplexNoise instead of pure randomness
-    unsigned int seed = static_cast<unsigned int>(std::time(nullptr));
     PerlinNoise noise(seed);
     
     auto allHexes = getAllHexes();
@@ -152,35 +186,6 @@ void HexGrid::highlightHexes(const std::function<bool(const Hexagon::CubeCoord&)
     }
 }
 
-void HexGrid::highlightAdjacentHexes(const Hexagon::CubeCoord& coord, sf::Color color, std::vector<TerrainType> traversableTerrain) {
-    std::cout << "Highlighting adjacent hexes from (" << coord.q << "," << coord.r << ")" << std::endl;
-    std::cout << "Traversable terrain types: ";
-    for (const auto& terrainType : traversableTerrain) {
-        std::cout << static_cast<int>(terrainType) << " ";
-    }
-    std::cout << std::endl;
-    
-    auto adjacentHexes = getAdjacentHexes(coord);
-    std::cout << "Found " << adjacentHexes.size() << " adjacent hexes" << std::endl;
-    
-    for (const auto& adjCoord : adjacentHexes) {
-        auto hexIter = mHexagons.find(adjCoord);
-        if (hexIter != mHexagons.end()) {
-            TerrainType hexTerrainType = hexIter->second->getTerrainType();
-            std::cout << "  Adjacent hex at (" << adjCoord.q << "," << adjCoord.r << ") has terrain type: " 
-                      << static_cast<int>(hexTerrainType) << std::endl;
-            
-            bool canTraverse = std::find(traversableTerrain.begin(), traversableTerrain.end(), hexTerrainType) != traversableTerrain.end();
-            std::cout << "  Can traverse: " << (canTraverse ? "YES" : "NO") << std::endl;
-            
-            if (canTraverse) {
-                hexIter->second->highlight(color);
-                std::cout << "  Highlighting this hex" << std::endl;
-            }
-        }
-    }
-}
-
 void HexGrid::highlightPath(const std::vector<Hexagon::CubeCoord>& path, sf::Color color) {
     for (const auto& coord : path) {
         auto hexIter = mHexagons.find(coord);
@@ -204,6 +209,14 @@ Hexagon* HexGrid::getHexAt(const Hexagon::CubeCoord& coord) {
     return nullptr;
 }
 
+const Hexagon* HexGrid::getHexAt(const Hexagon::CubeCoord& coord) const {
+    auto hexIter = mHexagons.find(coord);
+    if (hexIter != mHexagons.end()) {
+        return hexIter->second.get();
+    }
+    return nullptr;
+}
+
 Hexagon* HexGrid::getHexAtPixel(const sf::Vector2f& pixelPos) {
     // Convert pixel coordinates to cube coordinates
     Hexagon::CubeCoord coord = Hexagon::pixelToCube(pixelPos, mHexSize);
@@ -273,10 +286,10 @@ Hexagon::CubeCoord HexGrid::pixelToCube(const sf::Vector2f& pixel) const {
     return Hexagon::pixelToCube(pixel, mHexSize);
 }
 
-// Reset visibility for all hexes
+// Reset visibility for all hexes and factions
 void HexGrid::resetVisibility() {
-    for (auto& [coord, hex] : mHexagons) {
-        hex->setVisible(false);
+    for (Hexagon* hex : mTiles) {
+        hex->clearVisibility();
     }
 }
 
@@ -0,0 +1,128 @@
+#include "../../include/graphics/HudLayer.h"
+#include "../../include/graphics/TextureManager.h"
+#include <iostream>
+#include <sstream>
+
+namespace {
+    void appendQuad(std::vector<sf::Vertex>& vertices, sf::Vector2f min, sf::Vector2f max, const sf::Color& color) {
+        vertices.push_back({min, color});
+        vertices.push_back({{max.x, min.y}, color});
+        vertices.push_back({max, color});
+        vertices.push_back({min, color});
+        vertices.push_back({max, color});
+        vertices.push_back({{min.x, max.y}, color});
+    }
+}
+
+HudLayer::HudLayer() {
+    // Text is drawn from glyph textures, so without textures there is none
+    if (!TextureManager::getInstance().areTexturesEnabled()) {
+        return;
+    }
+    
+    // Initialize font for UI text
+    if (!mFont.openFromFile("assets/fonts/arial.ttf")) {
+        // Fallback to default system font if asset not found
+        std::cerr << "Warning: Could not load font from assets/fonts/arial.ttf" << std::endl;
+    } else {
+        // Create the text object with the loaded font - font parameter must be first
+        mGovernmentText.text.emplace(mFont, "", 16);
+        mGovernmentText.text->setFillColor(sf::Color::White);
+        mGovernmentText.text->setPosition({10.f, 10.f});
+    }
+}
+
+void HudLayer::setPanels(const std::vector<RectCommand>& rects, std::uint32_t revision) {
+    if (mPanelRevision == revision) {
+        return;
+    }
+    mPanelRevision = revision;
+    mPanels = rects;
+    mPanelsDirty = true;
+}
+
+void HudLayer::setGovernmentData(const HudData& hud) {
+    bool changed = !mShownHud.has_value()
+        || mShownHud->treasury != hud.treasury
+        || mShownHud->taxRate != hud.taxRate
+        || mShownHud->interestRate != hud.interestRate
+        || mShownHud->gdp != hud.gdp
+        || mShownHud->qualityLevel != hud.qualityLevel
+        || mShownHud->pathsPending != hud.pathsPending
+        || mShownHud->pathCacheHits != hud.pathCacheHits
+        || mShownHud->pathCacheLookups != hud.pathCacheLookups;
+
+    if (changed) {
+        mShownHud = hud;
+        mGovernmentText.dirty = true;
+    }
+}
+
+void HudLayer::draw(RenderBackend& backend) {
+    if (mGovernmentText.dirty && mShownHud.has_value()) {
+        layOutGovernmentText(*mShownHud);
+        mGovernmentText.dirty = false;
+
+        // The text's background panel follows its size
+        mPanelsDirty = true;
+    }
+
+    if (mPanelsDirty) {
+        rebuildPanelVertices();
+        mPanelsDirty = false;
+    }
+
+    if (!mPanelVertices.empty()) {
+        backend.draw(mPanelVertices.data(), mPanelVertices.size(), sf::PrimitiveType::Triangles);
+    }
+    if (mGovernmentText.text.has_value()) {
+        backend.drawText(*mGovernmentText.text);
+    }
+}
+
+void HudLayer::layOutGovernmentText(const HudData& hud) {
+    // Only render if text was successfully created
+    if (!mGovernmentText.text.has_value()) {
+        return;
+    }
+
+    // Create text to display
+    std::stringstream ss;
+    ss << "Government Data:" << std::endl
+       << "Treasury: $" << hud.treasury << std::endl
+       << "Tax Rate: " << (hud.taxRate * 100) << "%" << std::endl
+       << "Interest Rate: " << (hud.interestRate * 100) << "%" << std::endl
+       << "GDP: $" << hud.gdp;
+    
+    // Only shown while the frame-budget governor has turned something off
+    if (hud.qualityLevel > 0) {
+        ss << std::endl << "Quality level: " << hud.qualityLevel << std::endl
+           << "Routes pending: " << hud.pathsPending << std::endl
+           << "Route cache hits: " << hud.pathCacheHits << "/" << hud.pathCacheLookups;
+    }
+
+    mGovernmentText.text->setString(ss.str());
+}
+
+void HudLayer::rebuildPanelVertices() {
+    mPanelVertices.clear();
+
+    for (const auto& rect : mPanels) {
+        sf::Vector2f min = rect.bounds.position;
+        sf::Vector2f max = rect.bounds.position + rect.bounds.size;
+
+        // Outline is drawn outside the bounds, like sf::Shape does
+        if (rect.outlineThickness > 0.f) {
+            float t = rect.outlineThickness;
+            appendQuad(mPanelVertices, {min.x - t, min.y - t}, {max.x + t, max.y + t}, rect.outlineColor);
+        }
+        appendQuad(mPanelVertices, min, max, rect.fillColor);
+    }
+
+    if (mGovernmentText.text.has_value() && !mGovernmentText.text->getString().isEmpty()) {
+        sf::FloatRect bounds = mGovernmentText.text->getGlobalBounds();
+        sf::Vector2f padding(mGovernmentText.panelPadding, mGovernmentText.panelPadding);
+        appendQuad(mPanelVertices, bounds.position - padding, bounds.position + bounds.size + padding,
+                   mGovernmentText.panelColor);
+    }
+}
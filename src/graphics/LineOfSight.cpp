@@ -0,0 +1,91 @@
+#include "../../include/graphics/LineOfSight.h"
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <utility>
+
+namespace {
+    // Round fractional cube coordinates to the hex containing them
+    std::pair<int, int> roundCube(float q, float r, float s) {
+        int rq = static_cast<int>(std::round(q));
+        int rr = static_cast<int>(std::round(r));
+        int rs = static_cast<int>(std::round(s));
+
+        float dq = std::abs(rq - q);
+        float dr = std::abs(rr - r);
+        float ds = std::abs(rs - s);
+
+        if (dq > dr && dq > ds) {
+            rq = -rr - rs;
+        } else if (dr > ds) {
+            rr = -rq - rs;
+        }
+        return {rq, rr};
+    }
+
+    int distance(int dq, int dr) {
+        return (std::abs(dq) + std::abs(dr) + std::abs(dq + dr)) / 2;
+    }
+}
+
+const LineOfSightTable& LineOfSightTable::forRange(int range) {
+    static std::vector<std::unique_ptr<LineOfSightTable>> tables;
+
+    range = std::max(range, 0);
+    if (range >= static_cast<int>(tables.size())) {
+        tables.resize(range + 1);
+    }
+    if (!tables[range]) {
+        tables[range].reset(new LineOfSightTable(range));
+    }
+    return *tables[range];
+}
+
+LineOfSightTable::LineOfSightTable(int range) {
+    // Every offset in the disk, nearest first so a line's tiles precede its target
+    for (int dq = -range; dq <= range; dq++) {
+        for (int dr = std::max(-range, -dq - range); dr <= std::min(range, -dq + range); dr++) {
+            mEntries.push_back({dq, dr, {0, 0, 0, 0}});
+        }
+    }
+    std::stable_sort(mEntries.begin(), mEntries.end(), [](const Entry& a, const Entry& b) {
+        return distance(a.dq, a.dr) < distance(b.dq, b.dr);
+    });
+
+    std::map<std::pair<int, int>, std::uint32_t> entryAt;
+    for (std::uint32_t i = 0; i < mEntries.size(); ++i) {
+        entryAt[{mEntries[i].dq, mEntries[i].dr}] = i;
+    }
+
+    // The line to a tile runs exactly along hex edges in some directions;
+    // nudging it both ways gives the two lines a viewer could see along
+    const float nudges[2][3] = {{1e-4f, 2e-4f, -3e-4f}, {-1e-4f, -2e-4f, 3e-4f}};
+
+    for (auto& entry : mEntries) {
+        int d = distance(entry.dq, entry.dr);
+        for (int line = 0; line < 2; ++line) {
+            auto begin = static_cast<std::uint32_t>(mLineTiles.size());
+
+            // Every hex strictly between the observer and the target
+            for (int k = 1; k < d; ++k) {
+                float t = static_cast<float>(k) / static_cast<float>(d);
+                float q = entry.dq * t + nudges[line][0];
+                float r = entry.dr * t + nudges[line][1];
+                float s = -(entry.dq + entry.dr) * t + nudges[line][2];
+                mLineTiles.push_back(entryAt.at(roundCube(q, r, s)));
+            }
+
+            auto end = static_cast<std::uint32_t>(mLineTiles.size());
+            if (line == 1 && std::equal(mLineTiles.begin() + entry.lines[0], mLineTiles.begin() + entry.lines[1],
+                                        mLineTiles.begin() + begin, mLineTiles.end())) {
+                // Same tiles as the first line: share them
+                mLineTiles.resize(begin);
+                begin = entry.lines[0];
+                end = entry.lines[1];
+            }
+            entry.lines[line * 2] = begin;
+            entry.lines[line * 2 + 1] = end;
+        }
+    }
+}
@@ -0,0 +1,136 @@
+#include "../../include/graphics/ParticleSystem.h"
+#include <algorithm>
+#include <cmath>
+
+const ParticleSystem::EmitterParams ParticleSystem::BULLET_HIT = {
+    8, 40.f, 120.f, 0.15f, 0.35f, 1.5f, 2.5f, sf::Color(255, 220, 120), sf::Color(0, 30, 40)
+};
+
+const ParticleSystem::EmitterParams ParticleSystem::EXPLOSION = {
+    48, 30.f, 160.f, 0.4f, 0.9f, 2.5f, 5.f, sf::Color(255, 130, 30), sf::Color(0, 60, 30)
+};
+
+const ParticleSystem::EmitterParams ParticleSystem::BUILDING_DAMAGE = {
+    16, 15.f, 60.f, 0.5f, 1.2f, 2.f, 4.f, sf::Color(140, 130, 120), sf::Color(30, 30, 30)
+};
+
+ParticleSystem::ParticleSystem()
+    : mPositionX(CAPACITY), mPositionY(CAPACITY),
+      mVelocityX(CAPACITY), mVelocityY(CAPACITY),
+      mLifetime(CAPACITY), mInvMaxLifetime(CAPACITY),
+      mSize(CAPACITY), mColor(CAPACITY),
+      mRandom(std::random_device{}()) {
+}
+
+void ParticleSystem::emitBulletHit(const sf::Vector2f& position) {
+    emit(BULLET_HIT, position);
+}
+
+void ParticleSystem::emitExplosion(const sf::Vector2f& position) {
+    emit(EXPLOSION, position);
+}
+
+void ParticleSystem::emitBuildingDamage(const sf::Vector2f& position) {
+    emit(BUILDING_DAMAGE, position);
+}
+
+void ParticleSystem::emit(const EmitterParams& params, const sf::Vector2f& position) {
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+    std::uniform_int_distribution<int> variation(-1, 1);
+
+    // When the pool is full the rest of the burst is dropped
+    std::size_t count = std::min<std::size_t>(params.count, CAPACITY - mCount);
+    for (std::size_t n = 0; n < count; ++n) {
+        std::size_t i = mCount++;
+
+        float angle = unit(mRandom) * 6.2831853f;
+        float speed = params.minSpeed + unit(mRandom) * (params.maxSpeed - params.minSpeed);
+        float lifetime = params.minLifetime + unit(mRandom) * (params.maxLifetime - params.minLifetime);
+
+        mPositionX[i] = position.x;
+        mPositionY[i] = position.y;
+        mVelocityX[i] = std::cos(angle) * speed;
+        mVelocityY[i] = std::sin(angle) * speed;
+        mLifetime[i] = lifetime;
+        mInvMaxLifetime[i] = 1.f / lifetime;
+        mSize[i] = params.minSize + unit(mRandom) * (params.maxSize - params.minSize);
+
+        auto channel = [&](std::uint8_t base, std::uint8_t spread) {
+            return static_cast<std::uint8_t>(std::clamp(base + variation(mRandom) * spread, 0, 255));
+        };
+        sf::Color color(channel(params.color.r, params.colorVariation.r),
+                        channel(params.color.g, params.colorVariation.g),
+                        channel(params.color.b, params.colorVariation.b),
+                        params.color.a);
+        mColor[i] = color.toInteger();
+    }
+}
+
+void ParticleSystem::update(float deltaTime) {
+    const std::size_t count = mCount;
+    const float damping = std::pow(DRAG, deltaTime);
+
+    // Plain loops over flat float arrays, so the compiler can vectorize them
+    float* positionX = mPositionX.data();
+    float* positionY = mPositionY.data();
+    float* velocityX = mVelocityX.data();
+    float* velocityY = mVelocityY.data();
+    float* lifetime = mLifetime.data();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        velocityX[i] *= damping;
+        velocityY[i] *= damping;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        lifetime[i] -= deltaTime;
+    }
+
+    // Compact: swap expired particles with the last live one
+    for (std::size_t i = 0; i < mCount;) {
+        if (mLifetime[i] <= 0.f) {
+            kill(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void ParticleSystem::kill(std::size_t index) {
+    std::size_t last = --mCount;
+    mPositionX[index] = mPositionX[last];
+    mPositionY[index] = mPositionY[last];
+    mVelocityX[index] = mVelocityX[last];
+    mVelocityY[index] = mVelocityY[last];
+    mLifetime[index] = mLifetime[last];
+    mInvMaxLifetime[index] = mInvMaxLifetime[last];
+    mSize[index] = mSize[last];
+    mColor[index] = mColor[last];
+}
+
+void ParticleSystem::captureRenderState(std::vector<sf::Vertex>& vertices) const {
+    std::size_t first = vertices.size();
+    vertices.resize(first + mCount * VERTICES_PER_PARTICLE);
+    sf::Vertex* out = vertices.data() + first;
+
+    for (std::size_t i = 0; i < mCount; ++i) {
+        // Fade out over the particle's life
+        sf::Color color(mColor[i]);
+        color.a = static_cast<std::uint8_t>(color.a * std::min(1.f, mLifetime[i] * mInvMaxLifetime[i]));
+
+        float half = mSize[i] / 2.f;
+        sf::Vector2f min(mPositionX[i] - half, mPositionY[i] - half);
+        sf::Vector2f max(mPositionX[i] + half, mPositionY[i] + half);
+
+        out[0] = {min, color};
+        out[1] = {{max.x, min.y}, color};
+        out[2] = {max, color};
+        out[3] = {min, color};
+        out[4] = {max, color};
+        out[5] = {{min.x, max.y}, color};
+        out += VERTICES_PER_PARTICLE;
+    }
+}
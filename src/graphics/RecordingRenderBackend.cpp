@@ -0,0 +1,91 @@
+#include "../../include/graphics/RecordingRenderBackend.h"
+
+RecordingRenderBackend::RecordingRenderBackend(const sf::Vector2u& size)
+    : mSize(size),
+      mDefaultView(sf::FloatRect({0.f, 0.f}, {static_cast<float>(size.x), static_cast<float>(size.y)})),
+      mView(mDefaultView) {
+}
+
+void RecordingRenderBackend::clear(const sf::Color& color) {
+    mCurrentFrame.clears++;
+}
+
+void RecordingRenderBackend::setView(const sf::View& view) {
+    // Only count real changes, like a render target that caches its state would
+    if (view.getCenter() != mView.getCenter() || view.getSize() != mView.getSize()
+        || view.getViewport() != mView.getViewport()) {
+        mView = view;
+        mViewChanged = true;
+    }
+}
+
+void RecordingRenderBackend::draw(const sf::Vertex* vertices, std::size_t vertexCount,
+                                  sf::PrimitiveType type, const sf::RenderStates& states) {
+    record(type, vertexCount, states.texture, states.blendMode);
+}
+
+void RecordingRenderBackend::drawText(const sf::Text& text) {
+    // Text is drawn as two triangles per visible glyph from the font's page
+    // texture for its character size. Fetching that texture or laying out the
+    // text rasterizes glyphs and needs a GL context, so the glyphs are counted
+    // from the string and the page is identified by font and size instead.
+    std::size_t glyphs = 0;
+    for (char32_t c : text.getString()) {
+        if (c != U' ' && c != U'\n' && c != U'\t') {
+            glyphs++;
+        }
+    }
+    record(sf::PrimitiveType::Triangles, glyphs * 6, nullptr, sf::BlendAlpha, &text.getFont(), text.getCharacterSize());
+}
+
+void RecordingRenderBackend::record(sf::PrimitiveType type, std::size_t vertexCount,
+                                    const sf::Texture* texture, const sf::BlendMode& blendMode,
+                                    const sf::Font* font, unsigned characterSize) {
+    bool textureSwitch = mFirstDraw || texture != mLastTexture || font != mLastFont
+                         || characterSize != mLastCharacterSize;
+    bool stateChange = mFirstDraw || mViewChanged || blendMode != mLastBlendMode;
+
+    mRecords.push_back({type, vertexCount, texture, font, characterSize, textureSwitch, stateChange});
+
+    mCurrentFrame.drawCalls++;
+    mCurrentFrame.vertices += vertexCount;
+    if (textureSwitch) mCurrentFrame.textureSwitches++;
+    if (stateChange) mCurrentFrame.stateChanges++;
+
+    mLastTexture = texture;
+    mLastFont = font;
+    mLastCharacterSize = characterSize;
+    mLastBlendMode = blendMode;
+    mViewChanged = false;
+    mFirstDraw = false;
+}
+
+void RecordingRenderBackend::display() {
+    mFrameStats.push_back(mCurrentFrame);
+    mCurrentFrame = RenderFrameStats();
+
+    // Keep the last frame's records around for inspection, reuse the other buffer
+    mLastFrameRecords.swap(mRecords);
+    mRecords.clear();
+}
+
+RenderFrameStats RecordingRenderBackend::getTotals() const {
+    RenderFrameStats totals;
+    for (const auto& frame : mFrameStats) {
+        totals.drawCalls += frame.drawCalls;
+        totals.vertices += frame.vertices;
+        totals.textureSwitches += frame.textureSwitches;
+        totals.stateChanges += frame.stateChanges;
+        totals.clears += frame.clears;
+    }
+    return totals;
+}
+
+void RecordingRenderBackend::reset() {
+    mRecords.clear();
+    mLastFrameRecords.clear();
+    mFrameStats.clear();
+    mCurrentFrame = RenderFrameStats();
+    mFirstDraw = true;
+    mViewChanged = true;
+}
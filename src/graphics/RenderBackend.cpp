@@ -0,0 +1,34 @@
+#include "../../include/graphics/RenderBackend.h"
+
+WindowRenderBackend::WindowRenderBackend(sf::RenderWindow& window)
+    : mWindow(window) {
+}
+
+void WindowRenderBackend::clear(const sf::Color& color) {
+    mWindow.clear(color);
+}
+
+void WindowRenderBackend::setView(const sf::View& view) {
+    mWindow.setView(view);
+}
+
+const sf::View& WindowRenderBackend::getDefaultView() const {
+    return mWindow.getDefaultView();
+}
+
+sf::Vector2u WindowRenderBackend::getSize() const {
+    return mWindow.getSize();
+}
+
+void WindowRenderBackend::draw(const sf::Vertex* vertices, std::size_t vertexCount,
+                               sf::PrimitiveType type, const sf::RenderStates& states) {
+    mWindow.draw(vertices, vertexCount, type, states);
+}
+
+void WindowRenderBackend::drawText(const sf::Text& text) {
+    mWindow.draw(text);
+}
+
+void WindowRenderBackend::display() {
+    mWindow.display();
+}
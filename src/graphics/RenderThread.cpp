@@ -0,0 +1,64 @@
+#include "../../include/graphics/RenderThread.h"
+#include <iostream>
+
+RenderThread::RenderThread(sf::RenderWindow& window, Renderer& renderer)
+    : mWindow(window), mRenderer(renderer) {
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+void RenderThread::start() {
+    if (isRunning()) {
+        return;
+    }
+
+    mRunning.store(true, std::memory_order_release);
+    mThread = std::thread(&RenderThread::run, this);
+}
+
+void RenderThread::stop() {
+    mRunning.store(false, std::memory_order_release);
+    if (mThread.joinable()) {
+        mThread.join();
+    }
+}
+
+RenderSnapshot& RenderThread::beginFrame() {
+    RenderSnapshot& snapshot = mSnapshots.writeBuffer();
+    snapshot.clear();
+    snapshot.frame = mNextFrame++;
+    return snapshot;
+}
+
+void RenderThread::publishFrame() {
+    mSnapshots.publish();
+}
+
+void RenderThread::run() {
+    // The GL context can only be active on one thread at a time
+    if (!mWindow.setActive(true)) {
+        std::cerr << "RenderThread: Failed to activate the window context" << std::endl;
+        mRunning.store(false, std::memory_order_release);
+        return;
+    }
+
+    sf::Clock renderClock;
+    while (isRunning()) {
+        if (mSnapshots.acquire()) {
+            renderClock.restart();
+            mRenderer.render(mSnapshots.readBuffer());
+            mLastRenderMicroseconds.store(renderClock.getElapsedTime().asMicroseconds(), std::memory_order_relaxed);
+
+            mRenderer.display();
+        } else {
+            // Nothing new to draw yet, don't spin on the handoff
+            sf::sleep(sf::milliseconds(1));
+        }
+    }
+
+    if (!mWindow.setActive(false)) {
+        std::cerr << "RenderThread: Failed to release the window context" << std::endl;
+    }
+}
@@ -1,78 +1,220 @@
 #include "../../include/graphics/Renderer.h"
+#include <algorithm>
+#include <cmath>
 
-Renderer::Renderer(sf::RenderWindow& window)
-    : mWindow(window),
-      mBackgroundColor(sf::Color(30, 30, 30)) {
-}
-
-void Renderer::render(const HexGrid& grid) {
-    // Instead of directly rendering the grid, we'll handle each hex individually
-    // to apply fog of war effects
-    const auto& hexagons = grid.getHexagons();
+namespace {
+    // Hexagon dimensions (should match the ones in Hexagon class)
+    constexpr float HEX_SIZE = 25.0f;
     
-    for (const auto& [coord, hex] : hexagons) {
-        renderHex(mWindow, hex.get());
+    // Hexes are placed slightly closer than their size (see Hexagon::cubeToPixel),
+    // so the boundary two neighbors share lies on a hex this much smaller
+    constexpr float HEX_SPACING = 0.95f;
+
+    // How far remembered terrain is faded towards the fog color
+    constexpr float EXPLORED_FOG_AMOUNT = 0.6f;
+
+    sf::Color mix(const sf::Color& from, const sf::Color& to, float amount) {
+        auto channel = [amount](std::uint8_t a, std::uint8_t b) {
+            return static_cast<std::uint8_t>(a + (b - a) * amount);
+        };
+        return sf::Color(channel(from.r, to.r), channel(from.g, to.g), channel(from.b, to.b), channel(from.a, to.a));
+    }
+
+    void appendQuad(std::vector<sf::Vertex>& vertices,
+                    const sf::Vector2f& topLeft, const sf::Vector2f& topRight,
+                    const sf::Vector2f& bottomRight, const sf::Vector2f& bottomLeft,
+                    const sf::Color& color) {
+        vertices.push_back({topLeft, color});
+        vertices.push_back({topRight, color});
+        vertices.push_back({bottomRight, color});
+        vertices.push_back({topLeft, color});
+        vertices.push_back({bottomRight, color});
+        vertices.push_back({bottomLeft, color});
     }
 }
 
-// Generic render method for any GameObject
-void Renderer::render(const GameObject& gameObject) {
-    // Use the GameObject's render method to render itself
-    gameObject.render(mWindow);
+Renderer::Renderer(RenderBackend& backend)
+    : mBackend(backend),
+      mBackgroundColor(sf::Color(30, 30, 30)) {
+    // Pointy-top hexagon
+    for (int i = 0; i < 6; ++i) {
+        float angle = (i * 60.0f + 30.0f) * 3.14159f / 180.0f;
+        mHexCorners[i] = {HEX_SIZE * std::cos(angle), HEX_SIZE * std::sin(angle)};
+        mEdgeCorners[i] = mHexCorners[i] * HEX_SPACING;
+    }
 }
 
-void Renderer::clear() {
-    mWindow.clear(mBackgroundColor);
+void Renderer::render(const RenderSnapshot& snapshot) {
+    // With coarse fog the fog tiles are skipped and the background stands in for them
+    bool coarseFog = snapshot.fogOfWarEnabled && !snapshot.quality.drawFullFog;
+    mBackend.clear(coarseFog ? mUnexploredColor : mBackgroundColor);
+
+    // World layers use the camera captured with the snapshot
+    mBackend.setView(snapshot.camera);
+    renderGrid(snapshot);
+    renderTileOverlay(snapshot);
+    renderSprites(snapshot);
+    renderParticles(snapshot);
+    renderStatusBars(snapshot);
+
+    // Switch to default view for UI elements
+    mBackend.setView(mBackend.getDefaultView());
+    renderInterface(snapshot);
 }
 
 void Renderer::display() {
-    mWindow.display();
+    mBackend.display();
 }
 
-void Renderer::setView(const sf::View& view) {
-    mWindow.setView(view);
+void Renderer::renderGrid(const RenderSnapshot& snapshot) {
+    mGridVertices.clear();
+    mOutlineVertices.clear();
+
+    const RenderQuality& quality = snapshot.quality;
+    const GridOutlineStyle& outline = snapshot.gridOutline;
+
+    // World units covered by one screen pixel; grid lines are hidden when zoomed far out
+    float worldPerPixel = snapshot.camera.getSize().x / static_cast<float>(mBackend.getSize().x);
+    bool drawOutlines = outline.enabled && quality.drawOutlines && worldPerPixel <= outline.hideAboveZoom;
+    bool thickOutlines = outline.thickness > 1.f;
+    float halfThickness = outline.thickness * worldPerPixel / 2.f;
+
+    for (const auto& hex : snapshot.hexes) {
+        // Unexplored hexes are drawn as flat fog, explored ones as their
+        // remembered terrain dimmed towards the fog color
+        bool fogged = snapshot.fogOfWarEnabled && !hex.visible;
+        if (fogged && !hex.explored && !quality.drawFullFog) {
+            continue;
+        }
+        sf::Color color = hex.fillColor;
+        if (fogged) {
+            color = hex.explored ? mix(hex.fillColor, mUnexploredColor, EXPLORED_FOG_AMOUNT) : mUnexploredColor;
+        }
+
+        // Fan the hexagon out into four triangles from its first corner
+        for (int i = 1; i < 5; ++i) {
+            mGridVertices.push_back({hex.position + mHexCorners[0], color});
+            mGridVertices.push_back({hex.position + mHexCorners[i], color});
+            mGridVertices.push_back({hex.position + mHexCorners[i + 1], color});
+        }
+
+        // Each shared edge is flagged on one of its two hexes only
+        if (drawOutlines && hex.outlineEdges) {
+            for (int i = 0; i < 6; ++i) {
+                if (!(hex.outlineEdges & (1 << i))) {
+                    continue;
+                }
+                sf::Vector2f from = hex.position + mEdgeCorners[i];
+                sf::Vector2f to = hex.position + mEdgeCorners[(i + 1) % 6];
+                if (thickOutlines) {
+                    sf::Vector2f normal = (to - from).perpendicular().normalized() * halfThickness;
+                    appendQuad(mOutlineVertices, from + normal, to + normal, to - normal, from - normal, outline.color);
+                } else {
+                    mOutlineVertices.push_back({from, outline.color});
+                    mOutlineVertices.push_back({to, outline.color});
+                }
+            }
+        }
+    }
+
+    if (!mGridVertices.empty()) {
+        mBackend.draw(mGridVertices.data(), mGridVertices.size(), sf::PrimitiveType::Triangles);
+    }
+    if (!mOutlineVertices.empty()) {
+        mBackend.draw(mOutlineVertices.data(), mOutlineVertices.size(),
+                      thickOutlines ? sf::PrimitiveType::Triangles : sf::PrimitiveType::Lines);
+    }
+}
+
+void Renderer::renderSprites(const RenderSnapshot& snapshot) {
+    const auto& sprites = snapshot.sprites;
+
+    // Group sprites by layer, then by texture, so each run of equal textures
+    // becomes a single draw call. The index tiebreak keeps submission order
+    // within a group without needing a (temporary-buffer) stable sort.
+    mSpriteOrder.resize(sprites.size());
+    for (std::size_t i = 0; i < sprites.size(); ++i) {
+        mSpriteOrder[i] = i;
+    }
+    std::sort(mSpriteOrder.begin(), mSpriteOrder.end(), [&sprites](std::size_t a, std::size_t b) {
+        const SpriteCommand& lhs = sprites[a];
+        const SpriteCommand& rhs = sprites[b];
+        if (lhs.layer != rhs.layer) return lhs.layer < rhs.layer;
+        if (lhs.texture != rhs.texture) return std::less<const sf::Texture*>()(lhs.texture, rhs.texture);
+        return a < b;
+    });
+
+    mSpriteVertices.clear();
+    const sf::Texture* currentTexture = nullptr;
+
+    for (std::size_t index : mSpriteOrder) {
+        const SpriteCommand& sprite = sprites[index];
+        if (sprite.texture != currentTexture) {
+            flushSprites(currentTexture);
+            currentTexture = sprite.texture;
+        }
+
+        // Corners in local space, mapped through the object's transform
+        sf::Vector2f topLeft = sprite.transform.transformPoint({0.f, 0.f});
+        sf::Vector2f topRight = sprite.transform.transformPoint({sprite.size.x, 0.f});
+        sf::Vector2f bottomRight = sprite.transform.transformPoint({sprite.size.x, sprite.size.y});
+        sf::Vector2f bottomLeft = sprite.transform.transformPoint({0.f, sprite.size.y});
+
+        std::size_t first = mSpriteVertices.size();
+        appendQuad(mSpriteVertices, topLeft, topRight, bottomRight, bottomLeft, sprite.color);
+
+        if (sprite.texture) {
+            float left = static_cast<float>(sprite.textureRect.position.x);
+            float top = static_cast<float>(sprite.textureRect.position.y);
+            float right = left + static_cast<float>(sprite.textureRect.size.x);
+            float bottom = top + static_cast<float>(sprite.textureRect.size.y);
+
+            mSpriteVertices[first + 0].texCoords = {left, top};
+            mSpriteVertices[first + 1].texCoords = {right, top};
+            mSpriteVertices[first + 2].texCoords = {right, bottom};
+            mSpriteVertices[first + 3].texCoords = {left, top};
+            mSpriteVertices[first + 4].texCoords = {right, bottom};
+            mSpriteVertices[first + 5].texCoords = {left, bottom};
+        }
+    }
+    flushSprites(currentTexture);
 }
 
-void Renderer::renderHex(sf::RenderWindow& window, const Hexagon* hex) {
-    if (!mFogOfWarEnabled) {
-        // If fog of war is disabled, render everything normally
-        hex->draw(window);
+void Renderer::flushSprites(const sf::Texture* texture) {
+    if (mSpriteVertices.empty()) {
         return;
     }
-    
-    if (hex->isVisible()) {
-        // Fully visible - render normally
-        hex->draw(window);
-    } 
-    else {
-        // For non-visible hexes, show only black fog
-        renderFogOfWar(window, hex);
+
+    sf::RenderStates states;
+    states.texture = texture;
+    mBackend.draw(mSpriteVertices.data(), mSpriteVertices.size(), sf::PrimitiveType::Triangles, states);
+    mSpriteVertices.clear();
+}
+
+void Renderer::renderParticles(const RenderSnapshot& snapshot) {
+    // Untextured quads from the ParticleSystem, one draw for every effect
+    if (!snapshot.particles.empty()) {
+        mBackend.draw(snapshot.particles.data(), snapshot.particles.size(), sf::PrimitiveType::Triangles);
     }
 }
 
-void Renderer::renderFogOfWar(sf::RenderWindow& window, const Hexagon* hex) {
-    // Create a hexagon shape that matches the hex
-    sf::ConvexShape shape;
-    shape.setPointCount(6);
-    
-    // Get the hex position
-    sf::Vector2f position = hex->getPosition();
-    
-    // Hexagon dimensions (should match the ones in Hexagon class)
-    float size = 25.0f; // Match the SIZE in Hexagon
-    
-    // Define the points of the hexagon
-    for (int i = 0; i < 6; ++i) {
-        float angle = i * 60.0f + 30.0f; // 30 degrees offset to point upward
-        float rads = angle * 3.14159f / 180.0f;
-        float x = position.x + size * cos(rads);
-        float y = position.y + size * sin(rads);
-        shape.setPoint(i, sf::Vector2f(x, y));
+void Renderer::renderTileOverlay(const RenderSnapshot& snapshot) {
+    // Already laid out by the TileOverlay, one draw for all tiles
+    if (!snapshot.tileOverlay.empty()) {
+        mBackend.draw(snapshot.tileOverlay.data(), snapshot.tileOverlay.size(), sf::PrimitiveType::Triangles);
     }
-    
-    // Set the fill color for non-visible areas
-    shape.setFillColor(mUnexploredColor);
-    
-    // Draw the fog overlay
-    window.draw(shape);
-} 
\ No newline at end of file
+}
+
+void Renderer::renderStatusBars(const RenderSnapshot& snapshot) {
+    // Already laid out by the StatusOverlay, all bars go in one draw
+    if (!snapshot.statusBars.empty()) {
+        mBackend.draw(snapshot.statusBars.data(), snapshot.statusBars.size(), sf::PrimitiveType::Triangles);
+    }
+}
+
+void Renderer::renderInterface(const RenderSnapshot& snapshot) {
+    // The HUD only rebuilds what changed since the last frame
+    mHud.setPanels(snapshot.interfaceRects, snapshot.interfaceRevision);
+    mHud.setGovernmentData(snapshot.hud);
+    mHud.draw(mBackend);
+}
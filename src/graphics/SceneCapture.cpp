@@ -0,0 +1,86 @@
+#include "../../include/graphics/SceneCapture.h"
+#include "../../include/resources/Resource.h"
+#include "../../include/buildings/Building.h"
+
+sf::FloatRect SceneCapture::getCaptureArea(const sf::View& camera) {
+    // Expanded view bounds with margin to prevent hexes from popping in/out abruptly
+    sf::Vector2f viewCenter = camera.getCenter();
+    sf::Vector2f viewSize = camera.getSize();
+    return sf::FloatRect({viewCenter.x - viewSize.x / 2 - VIEW_MARGIN, viewCenter.y - viewSize.y / 2 - VIEW_MARGIN},
+                         {viewSize.x + VIEW_MARGIN * 2, viewSize.y + VIEW_MARGIN * 2});
+}
+
+void SceneCapture::captureGrid(RenderSnapshot& snapshot, const HexGrid& grid, const VisibilitySystem& visibility) {
+    sf::FloatRect captureArea = getCaptureArea(snapshot.camera);
+    
+    for (int index = 0; index < grid.getTileCount(); ++index) {
+        const Hexagon* hex = grid.getTile(index);
+        if (!captureArea.contains(hex->getPosition())) {
+            continue;
+        }
+        
+        bool visible = !snapshot.fogOfWarEnabled || hex->isVisible();
+        if (!visible) {
+            captureMemory(snapshot, *hex, index, visibility);
+            continue;
+        }
+        
+        std::uint8_t outlineEdges = getOutlineEdges(snapshot, grid, index);
+        snapshot.hexes.push_back({hex->getPosition(), hex->getFillColor(), true, true, outlineEdges});
+        
+        // Resources and buildings are only shown on visible hexes
+        if (hex->hasResource()) {
+            hex->getResource()->captureRenderState(snapshot.sprites, RenderLayer::Resources);
+        }
+        if (hex->hasBuilding()) {
+            hex->getBuilding()->captureRenderState(snapshot.sprites, RenderLayer::Buildings);
+        }
+    }
+}
+
+void SceneCapture::captureMemory(RenderSnapshot& snapshot, const Hexagon& hex, int index,
+                                 const VisibilitySystem& visibility) {
+    if (!hex.isExplored()) {
+        snapshot.hexes.push_back({hex.getPosition(), sf::Color::Black, false, false, 0});
+        return;
+    }
+    
+    // Seen before: the terrain and any structure as they were last seen
+    const auto& memory = visibility.getTileMemory(index, Allegiance::FRIENDLY);
+    snapshot.hexes.push_back({hex.getPosition(), memory.terrainColor, false, true, 0});
+    
+    if (const auto* structure = visibility.getRememberedStructure(index, Allegiance::FRIENDLY)) {
+        // Drawn darkened, so it reads as stale information
+        SpriteCommand sprite = structure->sprite;
+        sprite.color = sf::Color(sprite.color.r / 2, sprite.color.g / 2, sprite.color.b / 2, sprite.color.a);
+        snapshot.sprites.push_back(sprite);
+    }
+}
+
+std::uint8_t SceneCapture::getOutlineEdges(const RenderSnapshot& snapshot, const HexGrid& grid, int index) {
+    // Every tile owns its lower-right, lower-left and left edges (0-2). The
+    // opposite edges (3-5) belong to the neighbor across them, unless that
+    // neighbor is off the grid or fogged and so draws no outline itself.
+    std::uint8_t edges = 0b000111;
+    for (int edge = 3; edge < 6; ++edge) {
+        int neighbor = grid.getNeighborIndex(index, Hexagon::edgeDirection(edge));
+        bool neighborOutlined = neighbor >= 0
+            && (!snapshot.fogOfWarEnabled || grid.getTile(neighbor)->isVisible());
+        if (!neighborOutlined) {
+            edges |= 1 << edge;
+        }
+    }
+    return edges;
+}
+
+void SceneCapture::captureCharacter(RenderSnapshot& snapshot, const HexGrid& grid, const Character& character) {
+    // Only render the character if its hex is visible or fog of war is disabled
+    const Hexagon* hex = grid.getHexAt(character.getHexCoord());
+    if (!snapshot.fogOfWarEnabled || (hex && hex->isVisible())) {
+        character.captureRenderState(snapshot.sprites, RenderLayer::Units);
+    }
+}
+
+void SceneCapture::captureProjectiles(RenderSnapshot& snapshot, const ProjectilePool& projectiles, bool asSprite) {
+    projectiles.captureRenderState(snapshot.sprites, asSprite);
+}
@@ -26,13 +26,14 @@ SideBar::~SideBar() {
     // No dynamic resources to clean up
 }
 
-void SideBar::draw(sf::RenderWindow& window) {
-    // Draw background
-    window.draw(mBackground);
+void SideBar::captureRenderState(std::vector<RectCommand>& rects) const {
+    // Background first, then each cell on top
+    rects.push_back({sf::FloatRect(mBackground.getPosition(), mBackground.getSize()), mBackground.getFillColor(),
+                     mBackground.getOutlineColor(), mBackground.getOutlineThickness()});
     
-    // Draw each cell
     for (const auto& cell : mCells) {
-        window.draw(cell);
+        rects.push_back({sf::FloatRect(cell.getPosition(), cell.getSize()), cell.getFillColor(),
+                         cell.getOutlineColor(), cell.getOutlineThickness()});
     }
 }
 
@@ -75,4 +76,5 @@ void SideBar::updatePosition(const sf::Vector2f& windowSize) {
         mCells[i].setSize({WIDTH - 10.f, cellHeight - 10.f});
         mCells[i].setPosition({windowSize.x - WIDTH + 5.f, 5.f + i * cellHeight});
     }
+    ++mRevision;
 } 
\ No newline at end of file
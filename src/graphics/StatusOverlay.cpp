@@ -0,0 +1,156 @@
+#include "../../include/graphics/StatusOverlay.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    // Bar layout relative to the entity's center, in world units
+    constexpr float BAR_WIDTH = 20.f;
+    constexpr float BAR_HEIGHT = 3.f;
+    constexpr float BAR_SPACING = 1.f;
+    constexpr float BAR_OFFSET_Y = -18.f;
+
+    const sf::Color BAR_BACKGROUND(40, 0, 0, 200);
+    const sf::Color HEALTH_COLOR(60, 200, 60);
+    const sf::Color DEFENSE_COLOR(70, 130, 220);
+    const sf::Color COOLDOWN_COLOR(230, 180, 40);
+
+    // The cooldown bar fills in this many steps, so a reloading unit's slot
+    // is rewritten a few times per reload rather than every tick
+    constexpr float COOLDOWN_STEPS = 16.f;
+
+    float fraction(int value, int max) {
+        if (max <= 0) {
+            return 0.f;
+        }
+        return std::clamp(static_cast<float>(value) / static_cast<float>(max), 0.f, 1.f);
+    }
+
+    void writeQuad(sf::Vertex* vertices, sf::Vector2f min, sf::Vector2f max, sf::Color color) {
+        vertices[0] = {min, color};
+        vertices[1] = {{max.x, min.y}, color};
+        vertices[2] = {max, color};
+        vertices[3] = {min, color};
+        vertices[4] = {max, color};
+        vertices[5] = {{min.x, max.y}, color};
+    }
+}
+
+bool StatusOverlay::BarValues::operator==(const BarValues& other) const {
+    if (position != other.position || visible != other.visible) {
+        return false;
+    }
+    for (std::size_t bar = 0; bar < BARS_PER_ENTITY; ++bar) {
+        if (fractions[bar] != other.fractions[bar] || colors[bar] != other.colors[bar]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void StatusOverlay::beginFrame() {
+    ++mFrame;
+    mRebuiltCount = 0;
+}
+
+void StatusOverlay::updateCharacter(const Character& character, bool visible) {
+    BarValues values;
+    values.position = character.getPosition();
+    values.visible = visible;
+    values.fractions[0] = fraction(character.getHealth(), character.getMaxHealth());
+    values.colors[0] = HEALTH_COLOR;
+    // Full bar means ready to shoot
+    float ready = 1.f - fraction(character.getShootCooldown(), character.getShootCooldownLength());
+    values.fractions[1] = std::floor(ready * COOLDOWN_STEPS) / COOLDOWN_STEPS;
+    values.colors[1] = COOLDOWN_COLOR;
+    updateEntity(character.getId(), values);
+}
+
+void StatusOverlay::updateBuilding(const Building& building, bool visible) {
+    BarValues values;
+    values.position = building.getPosition();
+    values.visible = visible;
+    values.fractions[0] = fraction(building.getHealth(), building.getMaxHealth());
+    values.colors[0] = HEALTH_COLOR;
+    values.fractions[1] = fraction(building.getDefenses(), building.getMaxDefenses());
+    values.colors[1] = DEFENSE_COLOR;
+    updateEntity(building.getId(), values);
+}
+
+void StatusOverlay::endFrame() {
+    for (std::size_t slot = 0; slot < mSlots.size(); ++slot) {
+        Slot& entry = mSlots[slot];
+        if (entry.id != 0 && entry.lastSeen != mFrame) {
+            mSlotById.erase(entry.id);
+            entry = Slot();
+            clearSlot(slot);
+            ++mRevision;
+            mFreeSlots.push_back(slot);
+        }
+    }
+}
+
+void StatusOverlay::updateEntity(std::uint32_t id, const BarValues& values) {
+    std::size_t slot;
+    bool isNew = false;
+    auto it = mSlotById.find(id);
+    if (it != mSlotById.end()) {
+        slot = it->second;
+    } else {
+        slot = acquireSlot(id);
+        isNew = true;
+    }
+
+    Slot& entry = mSlots[slot];
+    entry.lastSeen = mFrame;
+    if (!isNew && entry.values == values) {
+        return;
+    }
+
+    entry.values = values;
+    writeSlot(slot);
+    ++mRebuiltCount;
+    ++mRevision;
+}
+
+std::size_t StatusOverlay::acquireSlot(std::uint32_t id) {
+    std::size_t slot;
+    if (!mFreeSlots.empty()) {
+        slot = mFreeSlots.back();
+        mFreeSlots.pop_back();
+    } else {
+        slot = mSlots.size();
+        mSlots.emplace_back();
+        mVertices.resize(mSlots.size() * VERTICES_PER_SLOT);
+    }
+    mSlots[slot].id = id;
+    mSlotById[id] = slot;
+    return slot;
+}
+
+void StatusOverlay::writeSlot(std::size_t slot) {
+    const BarValues& values = mSlots[slot].values;
+    if (!values.visible) {
+        clearSlot(slot);
+        return;
+    }
+
+    sf::Vertex* vertices = &mVertices[slot * VERTICES_PER_SLOT];
+    sf::Vector2f min(values.position.x - BAR_WIDTH / 2.f, values.position.y + BAR_OFFSET_Y);
+    for (std::size_t bar = 0; bar < BARS_PER_ENTITY; ++bar) {
+        sf::Vector2f max(min.x + BAR_WIDTH, min.y + BAR_HEIGHT);
+        sf::Vector2f fillMax(min.x + BAR_WIDTH * values.fractions[bar], max.y);
+
+        writeQuad(vertices, min, max, BAR_BACKGROUND);
+        writeQuad(vertices + 6, min, fillMax, values.colors[bar]);
+
+        vertices += 12;
+        min.y += BAR_HEIGHT + BAR_SPACING;
+    }
+}
+
+void StatusOverlay::clearSlot(std::size_t slot) {
+    // Zero-area triangles draw nothing but keep the array layout fixed
+    std::fill(mVertices.begin() + slot * VERTICES_PER_SLOT,
+              mVertices.begin() + (slot + 1) * VERTICES_PER_SLOT,
+              sf::Vertex{{0.f, 0.f}, sf::Color::Transparent});
+}
@@ -0,0 +1,36 @@
+#include "../../include/graphics/TileOverlay.h"
+#include <array>
+#include <cmath>
+
+namespace {
+    // Slightly inside the hex, so the grid lines stay visible between tiles
+    constexpr float OVERLAY_SIZE = 25.0f * 0.85f;
+    
+    // Pointy-top corners, matching the Renderer's hexagons
+    const std::array<sf::Vector2f, 6>& overlayCorners() {
+        static const std::array<sf::Vector2f, 6> corners = [] {
+            std::array<sf::Vector2f, 6> result;
+            for (int i = 0; i < 6; ++i) {
+                float angle = (i * 60.0f + 30.0f) * 3.14159f / 180.0f;
+                result[i] = {OVERLAY_SIZE * std::cos(angle), OVERLAY_SIZE * std::sin(angle)};
+            }
+            return result;
+        }();
+        return corners;
+    }
+}
+
+void TileOverlay::setTiles(const HexGrid& grid, const std::vector<int>& tiles, const sf::Color& color) {
+    const auto& corners = overlayCorners();
+    mVertices.resize(tiles.size() * VERTICES_PER_TILE);
+    
+    sf::Vertex* vertex = mVertices.data();
+    for (int tile : tiles) {
+        sf::Vector2f center = grid.getTile(tile)->getPosition();
+        for (int i = 0; i < 6; ++i) {
+            *vertex++ = {center, color};
+            *vertex++ = {center + corners[i], color};
+            *vertex++ = {center + corners[(i + 1) % 6], color};
+        }
+    }
+}
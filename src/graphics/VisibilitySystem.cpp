@@ -1,63 +1,350 @@
 #include "../../include/graphics/VisibilitySystem.h"
+#include <algorithm>
+
+namespace {
+    // Visit every on-grid tile within range of a center, walking the disk in
+    // axial coordinates
+    template <typename Visit>
+    void forEachInDisk(const HexGrid& grid, const Hexagon::CubeCoord& center, int range, Visit visit) {
+        for (int dq = -range; dq <= range; dq++) {
+            for (int dr = std::max(-range, -dq - range); dr <= std::min(range, -dq + range); dr++) {
+                int q = center.q + dq;
+                int r = center.r + dr;
+                int index = grid.getTileIndex(Hexagon::CubeCoord(q, r, -q - r));
+                if (index >= 0) {
+                    visit(index);
+                }
+            }
+        }
+    }
+}
 
 VisibilitySystem::VisibilitySystem() {
     // Constructor (currently empty)
 }
 
-void VisibilitySystem::updateVisibility(HexGrid& grid, 
-                                         const std::vector<Character*>& characters,
-                                         const std::vector<Building*>& buildings,
-                                         const std::vector<City*>& cities) {
-    // First reset all visibility
-    grid.resetVisibility();
+void VisibilitySystem::updateVisibility(HexGrid& grid, const std::vector<Character*>& characters) {
+    ensureGrid(grid);
+    updateStaticCoverage(grid);
+    ++mSyncCount;
     
-    // Set hexes visible around friendly characters only
+    // Every allegiance's observers are synced in the same pass
     for (const auto& character : characters) {
-        if (character && character->getAllegiance() == Allegiance::FRIENDLY) {
+        if (character) {
             // Use the character's own visibility range
-            setHexesVisibleAroundEntity(grid, character->getHexCoord(), character->getVisibilityRange());
+            syncObserver(grid, character->getId(), character->getAllegiance(), character->getHexCoord(),
+                         character->getVisibilityRange(), character->usesLineOfSight());
         }
     }
     
-    // Set hexes visible around friendly buildings only
-    for (const auto& building : buildings) {
-        if (building && building->getAllegiance() == Allegiance::FRIENDLY) {
-            // Convert pixel position to hex coordinate
-            Hexagon::CubeCoord buildingCoord = grid.pixelToCube(building->getPosition());
-            
-            // Use the building's own visibility range
-            setHexesVisibleAroundEntity(grid, buildingCoord, building->getVisibilityRange());
+    // Anything not seen in this pass is gone (dead or destroyed)
+    for (auto it = mObservers.begin(); it != mObservers.end();) {
+        if (it->second.lastSync != mSyncCount) {
+            unstamp(grid, it->second);
+            it = mObservers.erase(it);
+        } else {
+            ++it;
         }
     }
+}
+
+void VisibilitySystem::syncObserver(HexGrid& grid, ObserverId id, Allegiance faction,
+                                    const Hexagon::CubeCoord& center, int range, bool lineOfSight) {
+    auto it = mObservers.find(id);
+    if (it == mObservers.end()) {
+        addObserver(grid, id, faction, center, range, lineOfSight);
+        mObservers[id].lastSync = mSyncCount;
+        return;
+    }
+    
+    Observer& observer = it->second;
+    observer.lastSync = mSyncCount;
+    if (observer.faction != faction || observer.center != grid.getTileIndex(center)
+        || observer.range != range || observer.lineOfSight != lineOfSight) {
+        unstamp(grid, observer);
+        observer.faction = faction;
+        observer.center = grid.getTileIndex(center);
+        observer.range = range;
+        observer.lineOfSight = lineOfSight;
+        stamp(grid, observer);
+    }
+}
+
+void VisibilitySystem::addObserver(HexGrid& grid, ObserverId id, Allegiance faction,
+                                   const Hexagon::CubeCoord& center, int range, bool lineOfSight) {
+    ensureGrid(grid);
+    
+    Observer& observer = mObservers[id];
+    unstamp(grid, observer);
+    observer.faction = faction;
+    observer.center = grid.getTileIndex(center);
+    observer.range = range;
+    observer.lineOfSight = lineOfSight;
+    stamp(grid, observer);
+}
+
+void VisibilitySystem::moveObserver(HexGrid& grid, ObserverId id, const Hexagon::CubeCoord& center) {
+    auto it = mObservers.find(id);
+    if (it == mObservers.end()) {
+        return;
+    }
     
-    // Set hexes visible around friendly cities only
-    for (const auto& city : cities) {
-        if (city && city->getAllegiance() == Allegiance::FRIENDLY) {
-            // Convert pixel position to hex coordinate
-            Hexagon::CubeCoord cityCoord = grid.pixelToCube(city->getPosition());
-            
-            // Use the city's own visibility range - note: this was incomplete in original code
-            // We'll assume cities have a default visibility range of 2 (can adjust if needed)
-            setHexesVisibleAroundEntity(grid, cityCoord, 2);
+    Observer& observer = it->second;
+    int centerIndex = grid.getTileIndex(center);
+    if (observer.center == centerIndex) {
+        return;
+    }
+    unstamp(grid, observer);
+    observer.center = centerIndex;
+    stamp(grid, observer);
+}
+
+void VisibilitySystem::removeObserver(HexGrid& grid, ObserverId id) {
+    auto it = mObservers.find(id);
+    if (it == mObservers.end()) {
+        return;
+    }
+    unstamp(grid, it->second);
+    mObservers.erase(it);
+}
+
+void VisibilitySystem::addStaticObserver(ObserverId id, Allegiance faction, int centerTile, int range) {
+    mStaticObservers[id] = {faction, centerTile, range};
+    mStaticDirty = true;
+}
+
+void VisibilitySystem::removeStaticObserver(ObserverId id) {
+    if (mStaticObservers.erase(id) > 0) {
+        mStaticDirty = true;
+    }
+}
+
+void VisibilitySystem::setStaticObserverRange(ObserverId id, int range) {
+    auto it = mStaticObservers.find(id);
+    if (it != mStaticObservers.end() && it->second.range != range) {
+        it->second.range = range;
+        mStaticDirty = true;
+    }
+}
+
+void VisibilitySystem::updateStaticCoverage(HexGrid& grid) {
+    ensureGrid(grid);
+    if (!mStaticDirty) {
+        return;
+    }
+    mStaticDirty = false;
+    
+    mStaticScratch.assign(grid.getTileCount(), 0);
+    for (const auto& entry : mStaticObservers) {
+        const StaticObserver& observer = entry.second;
+        if (observer.center < 0 || observer.center >= grid.getTileCount()) {
+            continue;
+        }
+        std::uint8_t bit = factionBit(observer.faction);
+        forEachInDisk(grid, grid.getTile(observer.center)->getCoord(), observer.range,
+                      [&](int index) { mStaticScratch[index] |= bit; });
+    }
+    
+    // Only tiles no unit of the faction sees change state
+    mStaticScratch.swap(mStaticCoverage);
+    for (int index = 0; index < grid.getTileCount(); ++index) {
+        std::uint8_t changed = mStaticCoverage[index] ^ mStaticScratch[index];
+        if (changed == 0) {
+            continue;
+        }
+        for (int faction = 0; faction < FACTION_COUNT; ++faction) {
+            Allegiance allegiance = static_cast<Allegiance>(faction);
+            if ((changed & factionBit(allegiance)) && mViewerCounts[index * FACTION_COUNT + faction] == 0) {
+                setTileVisible(grid, index, allegiance, (mStaticCoverage[index] & factionBit(allegiance)) != 0);
+            }
         }
     }
 }
 
-void VisibilitySystem::setHexesVisibleAroundEntity(HexGrid& grid, const Hexagon::CubeCoord& center, int range) {
-    // Get all hexes within range
-    auto hexesInRange = grid.getHexesInRange(center, range);
+void VisibilitySystem::stamp(HexGrid& grid, Observer& observer) {
+    observer.tiles.clear();
+    if (observer.center < 0) {
+        return;
+    }
+    
+    Hexagon::CubeCoord center = grid.getTile(observer.center)->getCoord();
+    int range = observer.range;
     
-    // Set them all visible only - no longer tracking explored state
-    for (auto hex : hexesInRange) {
-        hex->setVisible(true);
-        // No longer setting explored state
+    if (!observer.lineOfSight) {
+        forEachInDisk(grid, center, range, [&](int index) { countTile(grid, observer, index); });
+        return;
     }
+    
+    // Walk the precomputed table; a tile is seen when either of its lines
+    // crosses no blocking tile. The observer always sees its own tile and past
+    // it, whatever it stands on. The grid edge blocks sight.
+    const auto& table = LineOfSightTable::forRange(range);
+    const auto& entries = table.getEntries();
+    const auto& lineTiles = table.getLineTiles();
+    auto lineClear = [&](std::uint32_t begin, std::uint32_t end) {
+        for (std::uint32_t k = begin; k < end; ++k) {
+            if (mSightBlocked[lineTiles[k]]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    mSightBlocked.resize(entries.size());
+    for (std::size_t i = 0; i < entries.size(); ++i) {
+        const auto& entry = entries[i];
+        int q = center.q + entry.dq;
+        int r = center.r + entry.dr;
+        int index = grid.getTileIndex(Hexagon::CubeCoord(q, r, -q - r));
+        mSightBlocked[i] = index < 0 || (i != 0 && blocksSight(grid.getTile(index)->getTerrainType()));
+
+        bool visible = lineClear(entry.lines[0], entry.lines[1]) ||
+                       (entry.lines[2] != entry.lines[0] && lineClear(entry.lines[2], entry.lines[3]));
+        if (visible && index >= 0) {
+            countTile(grid, observer, index);
+        }
+    }
+}
+
+void VisibilitySystem::countTile(HexGrid& grid, Observer& observer, int index) {
+    observer.tiles.push_back(index);
+    if (mViewerCounts[index * FACTION_COUNT + static_cast<int>(observer.faction)]++ == 0) {
+        setTileVisible(grid, index, observer.faction, true);
+    }
+}
+
+void VisibilitySystem::setTileVisible(HexGrid& grid, int index, Allegiance faction, bool visible) {
+    if (faction == Allegiance::FRIENDLY && !mFogOfWarEnabled) {
+        return;
+    }
+    applyTransition(grid, index, faction, visible);
+}
+
+void VisibilitySystem::applyTransition(HexGrid& grid, int index, Allegiance faction, bool visible) {
+    Hexagon* hex = grid.getTile(index);
+    if (visible) {
+        hex->setExploredBy(faction, true);
+    }
+    if (hex->isVisibleTo(faction) == visible) {
+        return;
+    }
+    
+    if (visible) {
+        // The live view replaces whatever was remembered
+        forgetStructure(index, faction);
+    } else {
+        remember(*hex, index, faction);
+    }
+    hex->setVisibleTo(faction, visible);
+    mChanges.push_back({index, faction, visible});
+}
+
+void VisibilitySystem::remember(const Hexagon& hex, int index, Allegiance faction) {
+    TileMemory& memory = mMemory[index * FACTION_COUNT + static_cast<int>(faction)];
+    memory.terrainColor = hex.getBaseColor();
+    memory.terrain = hex.getTerrainType();
+    forgetStructure(index, faction);
+    
+    // A faction's own buildings keep it company, only others' are worth remembering
+    const Building* building = hex.getBuilding();
+    if (!building || building->getAllegiance() == faction) {
+        return;
+    }
+    
+    mSpriteScratch.clear();
+    building->captureRenderState(mSpriteScratch, RenderLayer::Buildings);
+    if (mSpriteScratch.empty()) {
+        return;
+    }
+    
+    std::int32_t slot;
+    if (!mFreeStructures.empty()) {
+        slot = mFreeStructures.back();
+        mFreeStructures.pop_back();
+    } else {
+        slot = static_cast<std::int32_t>(mStructures.size());
+        mStructures.emplace_back();
+    }
+    mStructures[slot] = {mSpriteScratch.front(), building->getType(), building->getAllegiance()};
+    memory.structure = slot;
+}
+
+void VisibilitySystem::forgetStructure(int index, Allegiance faction) {
+    TileMemory& memory = mMemory[index * FACTION_COUNT + static_cast<int>(faction)];
+    if (memory.structure >= 0) {
+        mFreeStructures.push_back(memory.structure);
+        memory.structure = -1;
+    }
+}
+
+const VisibilitySystem::RememberedStructure* VisibilitySystem::getRememberedStructure(int tileIndex,
+                                                                                    Allegiance faction) const {
+    std::int32_t structure = getTileMemory(tileIndex, faction).structure;
+    return structure >= 0 ? &mStructures[structure] : nullptr;
+}
+
+void VisibilitySystem::unstamp(HexGrid& grid, Observer& observer) {
+    int faction = static_cast<int>(observer.faction);
+    for (int index : observer.tiles) {
+        if (--mViewerCounts[index * FACTION_COUNT + faction] == 0
+            && !(mStaticCoverage[index] & factionBit(observer.faction))) {
+            setTileVisible(grid, index, observer.faction, false);
+        }
+    }
+    observer.tiles.clear();
+}
+
+void VisibilitySystem::ensureGrid(const HexGrid& grid) {
+    if (mViewerCounts.size() != static_cast<std::size_t>(grid.getTileCount()) * FACTION_COUNT) {
+        mViewerCounts.assign(grid.getTileCount() * FACTION_COUNT, 0);
+        mMemory.assign(grid.getTileCount() * FACTION_COUNT, TileMemory());
+        mStructures.clear();
+        mFreeStructures.clear();
+        mObservers.clear();
+        mStaticCoverage.assign(grid.getTileCount(), 0);
+        mStaticDirty = !mStaticObservers.empty();
+    }
+}
+
+void VisibilitySystem::setFogOfWarEnabled(HexGrid& grid, bool enabled) {
+    ensureGrid(grid);
+    mFogOfWarEnabled = enabled;
+    
+    for (int index = 0; index < grid.getTileCount(); ++index) {
+        if (!enabled) {
+            // Revealing the map for debugging doesn't count as exploring it
+            Hexagon* hex = grid.getTile(index);
+            if (!hex->isVisible()) {
+                hex->setVisible(true);
+                mChanges.push_back({index, Allegiance::FRIENDLY, true});
+            }
+        } else {
+            applyTransition(grid, index, Allegiance::FRIENDLY, isSeen(index, Allegiance::FRIENDLY));
+        }
+    }
+}
+
+int VisibilitySystem::getViewerCount(int tileIndex, Allegiance faction) const {
+    std::size_t slot = static_cast<std::size_t>(tileIndex) * FACTION_COUNT + static_cast<int>(faction);
+    if (tileIndex < 0 || slot >= mViewerCounts.size()) {
+        return 0;
+    }
+    return mViewerCounts[slot];
 }
 
 void VisibilitySystem::resetAllVisibility(HexGrid& grid) {
-    for (auto hex : grid.getAllHexes()) {
-        hex->setVisible(false);
-        // No longer resetting explored state
+    mObservers.clear();
+    mStaticObservers.clear();
+    mStaticCoverage.assign(grid.getTileCount(), 0);
+    mStaticDirty = false;
+    mViewerCounts.assign(grid.getTileCount() * FACTION_COUNT, 0);
+    mMemory.assign(grid.getTileCount() * FACTION_COUNT, TileMemory());
+    mStructures.clear();
+    mFreeStructures.clear();
+    mChanges.clear();
+    grid.resetVisibility();
+    for (int index = 0; index < grid.getTileCount(); ++index) {
+        grid.getTile(index)->setVisible(!mFogOfWarEnabled);
     }
 }
 
@@ -73,4 +360,4 @@ int VisibilitySystem::getBuildingVisibilityRange(BuildingType type) const {
         default:
             return BUILDING_VISIBILITY_RANGE;
     }
-} 
\ No newline at end of file
+} 
@@ -0,0 +1,183 @@
+#include "../../include/pathfinding/CooperativePathfinder.h"
+#include <algorithm>
+
+namespace {
+    // Room for every state MAX_EXPANSIONS expansions can generate, at under half load
+    constexpr std::size_t STATE_SLOTS = 1u << 18;
+    
+    struct OpenNodeAfter {
+        template <typename Node>
+        bool operator()(const Node& a, const Node& b) const {
+            if (a.priority != b.priority) {
+                return a.priority > b.priority;
+            }
+            return a.cost < b.cost;
+        }
+    };
+    
+    std::uint64_t stateKey(int tile, int step) {
+        return static_cast<std::uint64_t>(tile) * ReservationTable::HORIZON + static_cast<std::uint64_t>(step);
+    }
+}
+
+void CooperativePathfinder::beginSearch() {
+    if (mSlotSearch.empty()) {
+        mSlotKey.assign(STATE_SLOTS, 0);
+        mSlotNode.assign(STATE_SLOTS, -1);
+        mSlotSearch.assign(STATE_SLOTS, 0);
+        mSearch = 0;
+    }
+    
+    if (++mSearch == 0) {
+        std::fill(mSlotSearch.begin(), mSlotSearch.end(), 0);
+        mSearch = 1;
+    }
+    mNodes.clear();
+    mOpen.clear();
+    mNodesExpanded = 0;
+    mReachesGoal = false;
+}
+
+int CooperativePathfinder::findOrAdd(int tile, int step, int cost, bool& isNew) {
+    std::uint64_t key = stateKey(tile, step);
+    std::size_t mask = STATE_SLOTS - 1;
+    std::size_t slot = static_cast<std::size_t>((key * 0x9e3779b97f4a7c15ull) >> 40) & mask;
+    while (mSlotSearch[slot] == mSearch) {
+        if (mSlotKey[slot] == key) {
+            isNew = false;
+            return mSlotNode[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+    
+    if (mNodes.size() >= STATE_SLOTS / 2) {
+        isNew = false;
+        return -1;
+    }
+    mSlotSearch[slot] = mSearch;
+    mSlotKey[slot] = key;
+    mSlotNode[slot] = static_cast<std::int32_t>(mNodes.size());
+    mNodes.push_back({tile, step, cost, -1});
+    isNew = true;
+    return mSlotNode[slot];
+}
+
+bool CooperativePathfinder::canHold(const ReservationTable& reservations, int tile, std::uint64_t step,
+                                    std::uint32_t owner) const {
+    for (std::uint64_t later = step; reservations.inWindow(later); ++later) {
+        if (reservations.isReservedByOther(tile, later, owner)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CooperativePathfinder::findPath(const NavigationGrid& grid, const ReservationTable& reservations, int start,
+                                     int goal, const MovementCosts& costs, Allegiance faction, std::uint32_t owner,
+                                     std::vector<int>& path, const FlowField* field,
+                                     const LandmarkTable* landmarks) {
+    path.clear();
+    int tileCount = grid.getTileCount();
+    if (start < 0 || goal < 0 || start >= tileCount || goal >= tileCount || start == goal) {
+        return false;
+    }
+    if (field && !field->reaches(start)) {
+        return false;
+    }
+    
+    std::uint64_t now = reservations.getStep();
+    auto isIdleUnit = [&](int tile) {
+        return tile != start && grid.hasUnit(tile) && reservations.getOwner(tile, now) == ReservationTable::NO_OWNER;
+    };
+    
+    // Without a field to fall back on, a goal that can't be reached ends the
+    // order; with one the unit still gets as close as it can
+    if (!field && (!costs.canEnter(grid.getTerrain(goal)) || isIdleUnit(goal))) {
+        return false;
+    }
+    
+    if (landmarks && (!landmarks->isValid() || landmarks->getCosts() != costs)) {
+        landmarks = nullptr;
+    }
+    auto heuristic = [&](int tile) {
+        if (field) {
+            return static_cast<int>(field->getCost(tile));
+        }
+        int estimate = grid.distance(tile, goal) * costs.minCost;
+        return landmarks ? std::max(estimate, landmarks->lowerBound(grid, tile, goal)) : estimate;
+    };
+    
+    beginSearch();
+    bool isNew;
+    findOrAdd(start, 0, 0, isNew);
+    mOpen.push_back({heuristic(start), 0, 0});
+    
+    OpenNodeAfter after;
+    int terminal = -1;
+    while (!mOpen.empty() && mNodesExpanded < MAX_EXPANSIONS) {
+        std::pop_heap(mOpen.begin(), mOpen.end(), after);
+        OpenNode open = mOpen.back();
+        mOpen.pop_back();
+        
+        Node node = mNodes[open.node];
+        if (open.cost != node.cost) {
+            continue;
+        }
+        ++mNodesExpanded;
+        
+        if (node.tile == goal && node.step > 0 && canHold(reservations, goal, now + node.step, owner)) {
+            terminal = open.node;
+            mReachesGoal = true;
+            break;
+        }
+        if (node.step == WINDOW) {
+            terminal = open.node;
+            break;
+        }
+        
+        // Six moves and a wait, all landing on the following step
+        std::uint64_t arrival = now + node.step + 1;
+        for (int direction = 0; direction <= 6; ++direction) {
+            int next = direction < 6 ? grid.getNeighbor(node.tile, direction) : node.tile;
+            if (next < 0 || reservations.isReservedByOther(next, arrival, owner)) {
+                continue;
+            }
+            
+            int cost = node.cost + WAIT_COST;
+            if (next != node.tile) {
+                TerrainType terrain = grid.getTerrain(next);
+                if (!costs.canEnter(terrain) || isIdleUnit(next)
+                    || (next != goal && grid.isBlockedFor(next, faction))
+                    || (field && !field->reaches(next))) {
+                    continue;
+                }
+                
+                // Two units trading places would pass through each other
+                std::uint32_t holder = reservations.getOwner(next, arrival - 1);
+                if (holder != ReservationTable::NO_OWNER && holder != owner
+                    && reservations.getOwner(node.tile, arrival) == holder) {
+                    continue;
+                }
+                cost = node.cost + costs.getCost(terrain);
+            }
+            
+            int index = findOrAdd(next, node.step + 1, cost, isNew);
+            if (index < 0 || (!isNew && cost >= mNodes[index].cost)) {
+                continue;
+            }
+            mNodes[index].cost = cost;
+            mNodes[index].parent = open.node;
+            mOpen.push_back({cost + heuristic(next), cost, index});
+            std::push_heap(mOpen.begin(), mOpen.end(), after);
+        }
+    }
+    
+    if (terminal < 0) {
+        return false;
+    }
+    for (int index = terminal; mNodes[index].parent >= 0; index = mNodes[index].parent) {
+        path.push_back(mNodes[index].tile);
+    }
+    std::reverse(path.begin(), path.end());
+    return true;
+}
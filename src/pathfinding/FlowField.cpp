@@ -0,0 +1,145 @@
+#include "../../include/pathfinding/FlowField.h"
+#include <algorithm>
+
+namespace {
+    template <typename Node>
+    bool cheaperLast(const Node& a, const Node& b) {
+        return a.cost > b.cost;
+    }
+}
+
+int FlowField::getNextTile(const NavigationGrid& grid, int tile) const {
+    if (tile == mGoal || !reaches(tile)) {
+        return -1;
+    }
+    
+    int next = mNext[tile];
+    if (!grid.hasUnit(next)) {
+        return next;
+    }
+    
+    // Step around whoever is in the way, as long as it still gets closer
+    int best = -1;
+    for (int direction = 0; direction < 6; ++direction) {
+        int neighbor = grid.getNeighbor(tile, direction);
+        if (neighbor >= 0 && !grid.hasUnit(neighbor) && mCost[neighbor] < mCost[tile]
+            && (best < 0 || mCost[neighbor] < mCost[best])) {
+            best = neighbor;
+        }
+    }
+    return best;
+}
+
+std::uint64_t FlowFieldCache::makeKey(int goal, const MovementCosts& costs, Allegiance faction) {
+    // Terrain costs are small; four bits each is plenty to tell classes apart
+    std::uint64_t key = static_cast<std::uint32_t>(goal);
+    for (int terrain = 0; terrain < TERRAIN_TYPE_COUNT; ++terrain) {
+        key = (key << 4) | (costs.enterCost[terrain] & 0xf);
+    }
+    return (key << 4) | static_cast<std::uint64_t>(faction);
+}
+
+const FlowField* FlowFieldCache::findField(int goal, const MovementCosts& costs, Allegiance faction) const {
+    auto it = mIndex.find(makeKey(goal, costs, faction));
+    return it != mIndex.end() ? &it->second->field : nullptr;
+}
+
+const FlowField& FlowFieldCache::getField(const NavigationGrid& grid, int goal, const MovementCosts& costs,
+                                          Allegiance faction) {
+    if (grid.getRevision() != mRevision) {
+        clear();
+        mRevision = grid.getRevision();
+    }
+    
+    std::uint64_t key = makeKey(goal, costs, faction);
+    auto it = mIndex.find(key);
+    if (it != mIndex.end()) {
+        mFields.splice(mFields.begin(), mFields, it->second);
+        return it->second->field;
+    }
+    
+    // Reuse the least recently used field's buffers when full
+    if (mFields.size() >= MAX_FIELDS) {
+        mIndex.erase(mFields.back().key);
+        mFields.splice(mFields.begin(), mFields, std::prev(mFields.end()));
+    } else {
+        mFields.emplace_front();
+    }
+    Entry& entry = mFields.front();
+    entry.key = key;
+    build(grid, goal, costs, faction, entry.field);
+    mIndex[key] = mFields.begin();
+    return entry.field;
+}
+
+void FlowFieldCache::build(const NavigationGrid& grid, int goal, const MovementCosts& costs,
+                           Allegiance faction, FlowField& field) {
+    int tileCount = grid.getTileCount();
+    field.mGoal = goal;
+    field.mCost.assign(tileCount, FlowField::UNREACHABLE);
+    field.mNext.assign(tileCount, -1);
+    ++mBuildCount;
+    
+    if (goal < 0 || goal >= tileCount || !costs.canEnter(grid.getTerrain(goal))) {
+        return;
+    }
+    
+    // Dijkstra outward from the goal; stepping from a tile onto its parent
+    // costs the parent's terrain
+    field.mCost[goal] = 0;
+    mOpen.clear();
+    mOpen.push_back({0, goal});
+    while (!mOpen.empty()) {
+        std::pop_heap(mOpen.begin(), mOpen.end(), cheaperLast<OpenNode>);
+        OpenNode node = mOpen.back();
+        mOpen.pop_back();
+        if (node.cost != field.mCost[node.tile]) {
+            continue;
+        }
+        
+        // Tiles that can't be walked through still get a cost, so a unit
+        // standing on one knows its way out, but nothing is routed across them
+        if (node.tile != goal && (!costs.canEnter(grid.getTerrain(node.tile)) || grid.isBlockedFor(node.tile, faction))) {
+            continue;
+        }
+        
+        std::uint32_t stepCost = node.cost + costs.getCost(grid.getTerrain(node.tile));
+        for (int direction = 0; direction < 6; ++direction) {
+            int neighbor = grid.getNeighbor(node.tile, direction);
+            if (neighbor < 0 || stepCost >= field.mCost[neighbor]) {
+                continue;
+            }
+            field.mCost[neighbor] = stepCost;
+            field.mNext[neighbor] = node.tile;
+            mOpen.push_back({stepCost, neighbor});
+            std::push_heap(mOpen.begin(), mOpen.end(), cheaperLast<OpenNode>);
+        }
+    }
+}
+
+void FlowFieldCache::onTileChanged(const NavigationGrid& grid, int tile, NavigationChange change) {
+    if (change == NavigationChange::Unit) {
+        return;
+    }
+    
+    for (auto it = mFields.begin(); it != mFields.end();) {
+        const FlowField& field = it->field;
+        bool affected = field.reaches(tile);
+        for (int direction = 0; direction < 6 && !affected; ++direction) {
+            int neighbor = grid.getNeighbor(tile, direction);
+            affected = neighbor >= 0 && field.reaches(neighbor);
+        }
+        
+        if (affected) {
+            mIndex.erase(it->key);
+            it = mFields.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void FlowFieldCache::clear() {
+    mFields.clear();
+    mIndex.clear();
+}
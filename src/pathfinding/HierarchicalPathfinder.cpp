@@ -0,0 +1,427 @@
+#include "../../include/pathfinding/HierarchicalPathfinder.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+    // Min-heap on priority, ties to the entry furthest along
+    template <typename Node>
+    bool openAfter(const Node& a, const Node& b) {
+        if (a.priority != b.priority) {
+            return a.priority > b.priority;
+        }
+        return a.cost < b.cost;
+    }
+}
+
+HierarchicalPathfinder::HierarchicalPathfinder(const MovementCosts& costs)
+    : mCosts(costs) {
+}
+
+std::uint64_t HierarchicalPathfinder::pairKey(int a, int b) {
+    return (static_cast<std::uint64_t>(std::min(a, b)) << 32) | static_cast<std::uint32_t>(std::max(a, b));
+}
+
+void HierarchicalPathfinder::build(const NavigationGrid& grid) {
+    int tileCount = grid.getTileCount();
+    mRadius = 0;
+    for (int tile = 0; tile < tileCount; ++tile) {
+        mRadius = std::max(mRadius, std::max(std::abs(grid.getQ(tile)), std::abs(grid.getR(tile))));
+    }
+    mClustersPerAxis = (2 * mRadius + CLUSTER_SIZE) / CLUSTER_SIZE;
+    
+    mClusters.assign(mClustersPerAxis * mClustersPerAxis, Cluster());
+    mClusterOf.resize(tileCount);
+    for (int tile = 0; tile < tileCount; ++tile) {
+        int x = (grid.getQ(tile) + mRadius) / CLUSTER_SIZE;
+        int y = (grid.getR(tile) + mRadius) / CLUSTER_SIZE;
+        mClusterOf[tile] = x * mClustersPerAxis + y;
+        mClusters[mClusterOf[tile]].tiles.push_back(tile);
+    }
+    
+    for (int cluster = 0; cluster < static_cast<int>(mClusters.size()); ++cluster) {
+        auto& neighbors = mClusters[cluster].neighbors;
+        for (int tile : mClusters[cluster].tiles) {
+            for (int direction = 0; direction < 6; ++direction) {
+                int next = grid.getNeighbor(tile, direction);
+                if (next >= 0 && mClusterOf[next] != cluster
+                    && std::find(neighbors.begin(), neighbors.end(), mClusterOf[next]) == neighbors.end()) {
+                    neighbors.push_back(mClusterOf[next]);
+                }
+            }
+        }
+    }
+    
+    mNodes.clear();
+    mFreeNodes.clear();
+    mEntrances.clear();
+    mDirtyClusters.clear();
+    mQuery = Query();
+    
+    for (int cluster = 0; cluster < static_cast<int>(mClusters.size()); ++cluster) {
+        for (int neighbor : mClusters[cluster].neighbors) {
+            if (neighbor > cluster) {
+                buildEntrances(grid, cluster, neighbor);
+            }
+        }
+    }
+    for (int cluster = 0; cluster < static_cast<int>(mClusters.size()); ++cluster) {
+        buildLinks(grid, cluster);
+    }
+    
+    mRevision = grid.getRevision();
+    mBuilt = true;
+}
+
+int HierarchicalPathfinder::allocateNode() {
+    if (!mFreeNodes.empty()) {
+        int id = mFreeNodes.back();
+        mFreeNodes.pop_back();
+        mNodes[id] = Node();
+        return id;
+    }
+    mNodes.emplace_back();
+    return static_cast<int>(mNodes.size()) - 1;
+}
+
+void HierarchicalPathfinder::buildEntrances(const NavigationGrid& grid, int a, int b) {
+    int low = std::min(a, b);
+    int high = std::max(a, b);
+    std::vector<int>& entrances = mEntrances[pairKey(low, high)];
+    
+    // Crossings in tile order follow the border, so a run of crossings whose
+    // tiles touch on both sides is one opening; it gets one entrance, at the
+    // crossing halfway along
+    auto closeRun = [&]() {
+        if (mRun.empty()) {
+            return;
+        }
+        const Crossing& middle = mRun[mRun.size() / 2];
+        int inside = allocateNode();
+        int outside = allocateNode();
+        mNodes[inside].tile = middle.inside;
+        mNodes[inside].cluster = low;
+        mNodes[inside].partner = outside;
+        mNodes[inside].partnerCost = mCosts.getCost(grid.getTerrain(middle.outside));
+        mNodes[outside].tile = middle.outside;
+        mNodes[outside].cluster = high;
+        mNodes[outside].partner = inside;
+        mNodes[outside].partnerCost = mCosts.getCost(grid.getTerrain(middle.inside));
+        mClusters[low].nodes.push_back(inside);
+        mClusters[high].nodes.push_back(outside);
+        entrances.push_back(inside);
+        mRun.clear();
+    };
+    auto touches = [&](int x, int y) { return x == y || grid.distance(x, y) == 1; };
+    
+    mRun.clear();
+    for (int tile : mClusters[low].tiles) {
+        if (!canEnter(grid, tile)) {
+            continue;
+        }
+        for (int direction = 0; direction < 6; ++direction) {
+            int next = grid.getNeighbor(tile, direction);
+            if (next < 0 || mClusterOf[next] != high || !canEnter(grid, next)) {
+                continue;
+            }
+            if (!mRun.empty() && !(touches(tile, mRun.back().inside) && touches(next, mRun.back().outside))) {
+                closeRun();
+            }
+            mRun.push_back({tile, next});
+        }
+    }
+    closeRun();
+}
+
+void HierarchicalPathfinder::removeEntrances(int a, int b) {
+    int low = std::min(a, b);
+    int high = std::max(a, b);
+    auto it = mEntrances.find(pairKey(low, high));
+    if (it == mEntrances.end()) {
+        return;
+    }
+    
+    auto& lowNodes = mClusters[low].nodes;
+    auto& highNodes = mClusters[high].nodes;
+    for (int inside : it->second) {
+        int outside = mNodes[inside].partner;
+        lowNodes.erase(std::find(lowNodes.begin(), lowNodes.end(), inside));
+        highNodes.erase(std::find(highNodes.begin(), highNodes.end(), outside));
+        mNodes[inside] = Node();
+        mNodes[outside] = Node();
+        mFreeNodes.push_back(inside);
+        mFreeNodes.push_back(outside);
+    }
+    mEntrances.erase(it);
+}
+
+void HierarchicalPathfinder::buildLinks(const NavigationGrid& grid, int cluster) {
+    const auto& nodes = mClusters[cluster].nodes;
+    for (int from : nodes) {
+        Node& node = mNodes[from];
+        node.links.clear();
+        searchCluster(grid, cluster, node.tile, false, mQuery);
+        for (int to : nodes) {
+            int cost = tileCost(mQuery, mNodes[to].tile);
+            if (to != from && cost >= 0) {
+                node.links.push_back({to, cost});
+            }
+        }
+    }
+}
+
+void HierarchicalPathfinder::searchCluster(const NavigationGrid& grid, int cluster, int source, bool reverse,
+                                           Query& query) const {
+    if (query.tileSearch.size() != mClusterOf.size()) {
+        query.tileCost.assign(mClusterOf.size(), 0);
+        query.tileSearch.assign(mClusterOf.size(), 0);
+    }
+    
+    // Stamps are shared with the abstract search; start them all over on wrap
+    if (++query.search == 0) {
+        std::fill(query.tileSearch.begin(), query.tileSearch.end(), 0);
+        std::fill(query.nodeSearch.begin(), query.nodeSearch.end(), 0);
+        std::fill(query.goalSearch.begin(), query.goalSearch.end(), 0);
+        query.search = 1;
+    }
+    
+    query.tileCost[source] = 0;
+    query.tileSearch[source] = query.search;
+    query.open.clear();
+    query.open.push_back({0, 0, source});
+    while (!query.open.empty()) {
+        std::pop_heap(query.open.begin(), query.open.end(), openAfter<OpenNode>);
+        OpenNode open = query.open.back();
+        query.open.pop_back();
+        if (open.cost != query.tileCost[open.id]) {
+            continue;
+        }
+        
+        // Going backwards, the way in to this tile costs its own terrain,
+        // and only a passable tile can be walked through
+        if (reverse && open.id != source && !canEnter(grid, open.id)) {
+            continue;
+        }
+        
+        for (int direction = 0; direction < 6; ++direction) {
+            int next = grid.getNeighbor(open.id, direction);
+            if (next < 0 || mClusterOf[next] != cluster) {
+                continue;
+            }
+            int step;
+            if (reverse) {
+                step = mCosts.getCost(grid.getTerrain(open.id));
+            } else {
+                if (!canEnter(grid, next)) {
+                    continue;
+                }
+                step = mCosts.getCost(grid.getTerrain(next));
+            }
+            int cost = open.cost + step;
+            if (query.tileSearch[next] == query.search && cost >= query.tileCost[next]) {
+                continue;
+            }
+            query.tileSearch[next] = query.search;
+            query.tileCost[next] = cost;
+            query.open.push_back({cost, cost, next});
+            std::push_heap(query.open.begin(), query.open.end(), openAfter<OpenNode>);
+        }
+    }
+}
+
+void HierarchicalPathfinder::onTileChanged(int tile, NavigationChange change) {
+    if (change != NavigationChange::Terrain || !mBuilt || tile < 0 || tile >= static_cast<int>(mClusterOf.size())) {
+        return;
+    }
+    Cluster& cluster = mClusters[mClusterOf[tile]];
+    if (!cluster.dirty) {
+        cluster.dirty = true;
+        mDirtyClusters.push_back(mClusterOf[tile]);
+    }
+}
+
+void HierarchicalPathfinder::refreshDirtyClusters(const NavigationGrid& grid) {
+    if (mDirtyClusters.empty()) {
+        return;
+    }
+    
+    // New entrances on every border of a dirty cluster, then new links in
+    // every cluster that gained or lost nodes
+    mAffected.clear();
+    for (int cluster : mDirtyClusters) {
+        mClusters[cluster].dirty = false;
+        mAffected.push_back(cluster);
+        for (int neighbor : mClusters[cluster].neighbors) {
+            removeEntrances(cluster, neighbor);
+            buildEntrances(grid, cluster, neighbor);
+            mAffected.push_back(neighbor);
+        }
+    }
+    mDirtyClusters.clear();
+    
+    std::sort(mAffected.begin(), mAffected.end());
+    mAffected.erase(std::unique(mAffected.begin(), mAffected.end()), mAffected.end());
+    for (int cluster : mAffected) {
+        buildLinks(grid, cluster);
+    }
+}
+
+void HierarchicalPathfinder::refresh(const NavigationGrid& grid) {
+    if (!mBuilt || grid.getRevision() != mRevision) {
+        build(grid);
+    }
+    refreshDirtyClusters(grid);
+}
+
+bool HierarchicalPathfinder::findWaypoints(const NavigationGrid& grid, int start, int goal,
+                                           std::vector<int>& waypoints, Query& query) const {
+    waypoints.clear();
+    query.nodesExpanded = 0;
+    
+    int tileCount = grid.getTileCount();
+    if (!mBuilt || start < 0 || goal < 0 || start >= tileCount || goal >= tileCount || start == goal
+        || !canEnter(grid, goal)) {
+        return false;
+    }
+    
+    // The start and goal join the graph for this query only, as two extra nodes
+    int nodeCount = static_cast<int>(mNodes.size());
+    const int startNode = nodeCount;
+    const int goalNode = nodeCount + 1;
+    if (static_cast<int>(query.nodeSearch.size()) < nodeCount + 2) {
+        query.nodeCost.resize(nodeCount + 2);
+        query.nodeParent.resize(nodeCount + 2);
+        query.nodeSearch.resize(nodeCount + 2, 0);
+        query.goalCost.resize(nodeCount + 2);
+        query.goalSearch.resize(nodeCount + 2, 0);
+    }
+    
+    int startCluster = mClusterOf[start];
+    int goalCluster = mClusterOf[goal];
+    
+    // Ways out of the start's cluster, and straight to the goal if it is in there too
+    query.startEdges.clear();
+    searchCluster(grid, startCluster, start, false, query);
+    for (int node : mClusters[startCluster].nodes) {
+        int cost = tileCost(query, mNodes[node].tile);
+        if (cost >= 0) {
+            query.startEdges.push_back({node, cost});
+        }
+    }
+    if (startCluster == goalCluster && tileCost(query, goal) >= 0) {
+        query.startEdges.push_back({goalNode, tileCost(query, goal)});
+    }
+    
+    // Ways into the goal, from the nodes of its cluster
+    searchCluster(grid, goalCluster, goal, true, query);
+    std::uint32_t search = query.search;
+    for (int node : mClusters[goalCluster].nodes) {
+        int cost = tileCost(query, mNodes[node].tile);
+        if (cost >= 0) {
+            query.goalCost[node] = cost;
+            query.goalSearch[node] = search;
+        }
+    }
+    
+    auto tileOf = [&](int node) { return node == startNode ? start : node == goalNode ? goal : mNodes[node].tile; };
+    auto heuristic = [&](int node) { return grid.distance(tileOf(node), goal) * mCosts.minCost; };
+    
+    query.nodeCost[startNode] = 0;
+    query.nodeParent[startNode] = -1;
+    query.nodeSearch[startNode] = search;
+    query.open.clear();
+    query.open.push_back({heuristic(startNode), 0, startNode});
+    
+    auto relax = [&](int from, int to, int cost) {
+        if (query.nodeSearch[to] == search && cost >= query.nodeCost[to]) {
+            return;
+        }
+        query.nodeSearch[to] = search;
+        query.nodeCost[to] = cost;
+        query.nodeParent[to] = from;
+        query.open.push_back({cost + heuristic(to), cost, to});
+        std::push_heap(query.open.begin(), query.open.end(), openAfter<OpenNode>);
+    };
+    
+    while (!query.open.empty()) {
+        std::pop_heap(query.open.begin(), query.open.end(), openAfter<OpenNode>);
+        OpenNode open = query.open.back();
+        query.open.pop_back();
+        if (open.cost != query.nodeCost[open.id]) {
+            continue;
+        }
+        ++query.nodesExpanded;
+        
+        if (open.id == goalNode) {
+            for (int node = goalNode; node != startNode; node = query.nodeParent[node]) {
+                int tile = tileOf(node);
+                // Entrances can share a tile, and the first may be the start itself
+                if (tile != start && (waypoints.empty() || waypoints.back() != tile)) {
+                    waypoints.push_back(tile);
+                }
+            }
+            std::reverse(waypoints.begin(), waypoints.end());
+            return true;
+        }
+        
+        if (open.id == startNode) {
+            for (const Edge& edge : query.startEdges) {
+                relax(startNode, edge.node, open.cost + edge.cost);
+            }
+            continue;
+        }
+        
+        const Node& node = mNodes[open.id];
+        relax(open.id, node.partner, open.cost + node.partnerCost);
+        for (const Edge& link : node.links) {
+            relax(open.id, link.node, open.cost + link.cost);
+        }
+        if (query.goalSearch[open.id] == search) {
+            relax(open.id, goalNode, open.cost + query.goalCost[open.id]);
+        }
+    }
+    
+    return false;
+}
+
+bool HierarchicalPathfinder::traceRoute(const NavigationGrid& grid, int start, const std::vector<int>& waypoints,
+                                        std::vector<int>& route, Query& query) const {
+    route.clear();
+    int from = start;
+    for (int waypoint : waypoints) {
+        // Waypoints in different clusters are the two sides of an entrance
+        int cluster = mClusterOf[waypoint];
+        if (mClusterOf[from] != cluster) {
+            route.push_back(waypoint);
+            from = waypoint;
+            continue;
+        }
+        
+        // Walk back from the waypoint over tiles whose cost accounts for
+        // each step, then put the leg the right way round
+        searchCluster(grid, cluster, from, false, query);
+        std::size_t legStart = route.size();
+        for (int tile = waypoint; tile != from;) {
+            if (tileCost(query, tile) < 0) {
+                route.clear();
+                return false;
+            }
+            route.push_back(tile);
+            int before = tileCost(query, tile) - mCosts.getCost(grid.getTerrain(tile));
+            int previous = -1;
+            for (int direction = 0; direction < 6 && previous < 0; ++direction) {
+                int neighbor = grid.getNeighbor(tile, direction);
+                if (neighbor >= 0 && mClusterOf[neighbor] == cluster && tileCost(query, neighbor) == before) {
+                    previous = neighbor;
+                }
+            }
+            if (previous < 0) {
+                route.clear();
+                return false;
+            }
+            tile = previous;
+        }
+        std::reverse(route.begin() + legStart, route.end());
+        from = waypoint;
+    }
+    return true;
+}
@@ -0,0 +1,212 @@
+#include "../../include/pathfinding/LandmarkTable.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace {
+    // Min-heap on cost
+    struct CheaperLast {
+        template <typename Node>
+        bool operator()(const Node& a, const Node& b) const { return a.cost > b.cost; }
+    };
+    
+    // Tag at the start of stored tables
+    constexpr char STORE_TAG[4] = {'A', 'L', 'T', '1'};
+    
+    template <typename T>
+    void writeValue(std::ostream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+    
+    template <typename T>
+    bool readValue(std::istream& in, T& value) {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+    }
+}
+
+LandmarkTable::LandmarkTable(const MovementCosts& costs, int landmarkCount)
+    : mCosts(costs), mLandmarkCount(landmarkCount) {
+}
+
+std::uint64_t LandmarkTable::hashTerrain(const NavigationGrid& grid) {
+    // FNV-1a over the terrain of every tile
+    std::uint64_t hash = 14695981039346656037ull;
+    for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+        hash = (hash ^ static_cast<std::uint64_t>(grid.getTerrain(tile))) * 1099511628211ull;
+    }
+    return hash;
+}
+
+void LandmarkTable::pickLandmarks(const NavigationGrid& grid) {
+    // Landmarks work best behind the goal as seen from the start, so spread
+    // them around the rim: the map is cut into equal angular slices from the
+    // center and each slice gets its furthest passable tile
+    const double pi = std::acos(-1.0);
+    std::vector<int> best(mLandmarkCount, -1);
+    std::vector<int> bestRadius(mLandmarkCount, -1);
+    for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+        if (!mCosts.canEnter(grid.getTerrain(tile))) {
+            continue;
+        }
+        int q = grid.getQ(tile);
+        int r = grid.getR(tile);
+        int radius = (std::abs(q) + std::abs(r) + std::abs(q + r)) / 2;
+        double angle = std::atan2(r * 0.8660254, q + r * 0.5);
+        int slice = static_cast<int>((angle + pi) / (2.0 * pi) * mLandmarkCount) % mLandmarkCount;
+        if (radius > bestRadius[slice]) {
+            bestRadius[slice] = radius;
+            best[slice] = tile;
+        }
+    }
+    
+    mLandmarks.clear();
+    for (int tile : best) {
+        if (tile >= 0) {
+            mLandmarks.push_back(tile);
+        }
+    }
+}
+
+void LandmarkTable::computeDistances(const NavigationGrid& grid, int landmark, std::vector<std::uint32_t>& column,
+                                     std::vector<OpenNode>& open) const {
+    column.assign(grid.getTileCount(), UNREACHABLE);
+    column[landmark] = 0;
+    open.clear();
+    open.push_back({0, landmark});
+    
+    CheaperLast cheaperLast;
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), cheaperLast);
+        OpenNode node = open.back();
+        open.pop_back();
+        if (node.cost != column[node.tile]) {
+            continue;
+        }
+        
+        for (int direction = 0; direction < 6; ++direction) {
+            int next = grid.getNeighbor(node.tile, direction);
+            if (next < 0 || !mCosts.canEnter(grid.getTerrain(next))) {
+                continue;
+            }
+            std::uint32_t cost = node.cost + mCosts.getCost(grid.getTerrain(next));
+            if (cost < column[next]) {
+                column[next] = cost;
+                open.push_back({cost, next});
+                std::push_heap(open.begin(), open.end(), cheaperLast);
+            }
+        }
+    }
+}
+
+void LandmarkTable::build(const NavigationGrid& grid) {
+    pickLandmarks(grid);
+    int tileCount = grid.getTileCount();
+    int count = static_cast<int>(mLandmarks.size());
+    
+    // Each worker fills whole columns, so no two threads write near each
+    // other; the columns are interleaved per tile afterwards
+    std::vector<std::vector<std::uint32_t>> columns(count);
+    std::atomic<int> nextLandmark{0};
+    auto work = [&]() {
+        std::vector<OpenNode> open;
+        for (int index = nextLandmark++; index < count; index = nextLandmark++) {
+            computeDistances(grid, mLandmarks[index], columns[index], open);
+        }
+    };
+    
+    unsigned workers = std::min<unsigned>(count, std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    for (unsigned i = 1; i < workers; ++i) {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    mDistance.resize(static_cast<std::size_t>(tileCount) * count);
+    for (int tile = 0; tile < tileCount; ++tile) {
+        for (int index = 0; index < count; ++index) {
+            mDistance[static_cast<std::size_t>(tile) * count + index] = columns[index][tile];
+        }
+    }
+    mTerrainHash = hashTerrain(grid);
+    mValid = true;
+}
+
+void LandmarkTable::onTileChanged(int tile, NavigationChange change) {
+    if (change == NavigationChange::Terrain) {
+        mValid = false;
+    }
+}
+
+int LandmarkTable::lowerBound(const NavigationGrid& grid, int tile, int goal) const {
+    if (!mValid) {
+        return 0;
+    }
+    
+    // With L a landmark and d(L, x) the stored costs:
+    //   d(L, goal) <= d(L, tile) + d(tile, goal)
+    // and since walking a path backwards only swaps which end's terrain is
+    // paid for, d(x, L) = d(L, x) - c(x) + c(L), which gives
+    //   d(tile, goal) >= d(L, tile) - c(tile) - d(L, goal) + c(goal)
+    std::size_t count = mLandmarks.size();
+    const std::uint32_t* fromTile = &mDistance[static_cast<std::size_t>(tile) * count];
+    const std::uint32_t* fromGoal = &mDistance[static_cast<std::size_t>(goal) * count];
+    int tileCost = mCosts.getCost(grid.getTerrain(tile));
+    int goalCost = mCosts.getCost(grid.getTerrain(goal));
+    
+    int bound = 0;
+    for (std::size_t index = 0; index < count; ++index) {
+        if (fromTile[index] == UNREACHABLE || fromGoal[index] == UNREACHABLE) {
+            continue;
+        }
+        int toTile = static_cast<int>(fromTile[index]);
+        int toGoal = static_cast<int>(fromGoal[index]);
+        bound = std::max(bound, std::max(toGoal - toTile, toTile - tileCost - toGoal + goalCost));
+    }
+    return bound;
+}
+
+void LandmarkTable::write(std::ostream& out) const {
+    out.write(STORE_TAG, sizeof(STORE_TAG));
+    writeValue(out, static_cast<std::uint32_t>(mDistance.size() / std::max<std::size_t>(1, mLandmarks.size())));
+    writeValue(out, mTerrainHash);
+    writeValue(out, mCosts.enterCost);
+    writeValue(out, static_cast<std::uint32_t>(mLandmarks.size()));
+    out.write(reinterpret_cast<const char*>(mLandmarks.data()), mLandmarks.size() * sizeof(int));
+    out.write(reinterpret_cast<const char*>(mDistance.data()), mDistance.size() * sizeof(std::uint32_t));
+}
+
+bool LandmarkTable::read(std::istream& in, const NavigationGrid& grid) {
+    char tag[sizeof(STORE_TAG)];
+    std::uint32_t tileCount = 0;
+    std::uint64_t terrainHash = 0;
+    decltype(mCosts.enterCost) enterCost;
+    std::uint32_t count = 0;
+    if (!in.read(tag, sizeof(tag)) || !std::equal(tag, tag + sizeof(tag), STORE_TAG)
+        || !readValue(in, tileCount) || !readValue(in, terrainHash)
+        || !readValue(in, enterCost) || !readValue(in, count)) {
+        return false;
+    }
+    
+    // Tables for another map or another kind of unit would overestimate
+    if (tileCount != static_cast<std::uint32_t>(grid.getTileCount()) || enterCost != mCosts.enterCost
+        || count > static_cast<std::uint32_t>(mLandmarkCount) || terrainHash != hashTerrain(grid)) {
+        return false;
+    }
+    
+    std::vector<int> landmarks(count);
+    std::vector<std::uint32_t> distance(static_cast<std::size_t>(tileCount) * count);
+    if (!in.read(reinterpret_cast<char*>(landmarks.data()), landmarks.size() * sizeof(int))
+        || !in.read(reinterpret_cast<char*>(distance.data()), distance.size() * sizeof(std::uint32_t))) {
+        return false;
+    }
+    
+    mLandmarks.swap(landmarks);
+    mDistance.swap(distance);
+    mTerrainHash = terrainHash;
+    mValid = true;
+    return true;
+}
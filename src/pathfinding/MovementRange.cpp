@@ -0,0 +1,70 @@
+#include "../../include/pathfinding/MovementRange.h"
+#include <algorithm>
+
+namespace {
+    template <typename Node>
+    bool cheaperLast(const Node& a, const Node& b) {
+        return a.cost > b.cost;
+    }
+}
+
+void MovementRange::compute(const NavigationGrid& grid, int start, int movePoints, const MovementCosts& costs,
+                            Allegiance faction) {
+    int tileCount = grid.getTileCount();
+    if (static_cast<int>(mSearchOf.size()) != tileCount) {
+        mCost.assign(tileCount, 0);
+        mSearchOf.assign(tileCount, 0);
+        mSearch = 0;
+    }
+    if (++mSearch == 0) {
+        std::fill(mSearchOf.begin(), mSearchOf.end(), 0);
+        mSearch = 1;
+    }
+    
+    mTiles.clear();
+    mOpen.clear();
+    mStart = start;
+    if (start < 0 || start >= tileCount) {
+        return;
+    }
+    
+    mCost[start] = 0;
+    mSearchOf[start] = mSearch;
+    mOpen.push_back({0, start});
+    while (!mOpen.empty()) {
+        std::pop_heap(mOpen.begin(), mOpen.end(), cheaperLast<OpenNode>);
+        OpenNode node = mOpen.back();
+        mOpen.pop_back();
+        if (node.cost != mCost[node.tile]) {
+            continue;
+        }
+        if (node.tile != start) {
+            mTiles.push_back(node.tile);
+        }
+        
+        // Out of points: no further steps from here
+        if (node.cost >= movePoints) {
+            continue;
+        }
+        
+        for (int direction = 0; direction < 6; ++direction) {
+            int next = grid.getNeighbor(node.tile, direction);
+            if (next < 0 || next == start) {
+                continue;
+            }
+            TerrainType terrain = grid.getTerrain(next);
+            if (!costs.canEnter(terrain) || grid.hasUnit(next) || grid.isBlockedFor(next, faction)) {
+                continue;
+            }
+            
+            int cost = node.cost + costs.getCost(terrain);
+            if (mSearchOf[next] == mSearch && cost >= mCost[next]) {
+                continue;
+            }
+            mSearchOf[next] = mSearch;
+            mCost[next] = cost;
+            mOpen.push_back({cost, next});
+            std::push_heap(mOpen.begin(), mOpen.end(), cheaperLast<OpenNode>);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#include "../../include/pathfinding/NavigationGrid.h"
+#include "../../include/buildings/Building.h"
+
+NavigationGrid::NavigationGrid(const HexGrid& grid) {
+    build(grid);
+}
+
+void NavigationGrid::build(const HexGrid& grid) {
+    int count = grid.getTileCount();
+    mTerrain.resize(count);
+    mUnit.resize(count);
+    mBuildingOwner.resize(count);
+    mNeighbors.resize(count);
+    mQ.resize(count);
+    mR.resize(count);
+    
+    for (int tile = 0; tile < count; ++tile) {
+        const Hexagon* hex = grid.getTile(tile);
+        mTerrain[tile] = static_cast<std::uint8_t>(hex->getTerrainType());
+        mUnit[tile] = hex->hasCharacter() ? 1 : 0;
+        mBuildingOwner[tile] = hex->hasBuilding()
+            ? static_cast<std::int8_t>(hex->getBuilding()->getAllegiance()) : NO_OWNER;
+        for (int direction = 0; direction < 6; ++direction) {
+            mNeighbors[tile][direction] = grid.getNeighborIndex(tile, direction);
+        }
+        mQ[tile] = hex->getCoord().q;
+        mR[tile] = hex->getCoord().r;
+    }
+    ++mRevision;
+}
+
+void NavigationGrid::copyFrom(const NavigationGrid& other) {
+    if (mRevision != other.mRevision || mNeighbors.size() != other.mNeighbors.size()) {
+        mNeighbors = other.mNeighbors;
+        mQ = other.mQ;
+        mR = other.mR;
+        mRevision = other.mRevision;
+    }
+    mTerrain = other.mTerrain;
+    mUnit = other.mUnit;
+    mBuildingOwner = other.mBuildingOwner;
+}
+
+void NavigationGrid::setUnit(int tile, bool present) {
+    std::uint8_t value = present ? 1 : 0;
+    if (mUnit[tile] != value) {
+        mUnit[tile] = value;
+        notify(tile, NavigationChange::Unit);
+    }
+}
+
+void NavigationGrid::setBuilding(int tile, std::int8_t owner) {
+    if (mBuildingOwner[tile] != owner) {
+        mBuildingOwner[tile] = owner;
+        notify(tile, NavigationChange::Building);
+    }
+}
+
+void NavigationGrid::setTerrain(int tile, TerrainType terrain) {
+    std::uint8_t value = static_cast<std::uint8_t>(terrain);
+    if (mTerrain[tile] != value) {
+        mTerrain[tile] = value;
+        notify(tile, NavigationChange::Terrain);
+    }
+}
+
+void NavigationGrid::notify(int tile, NavigationChange change) {
+    for (const auto& listener : mListeners) {
+        listener(tile, change);
+    }
+}
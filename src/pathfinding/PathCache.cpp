@@ -0,0 +1,101 @@
+#include "../../include/pathfinding/PathCache.h"
+#include <algorithm>
+
+std::uint64_t PathCache::makeKey(int region, int goal, const MovementCosts& costs) {
+    // Goal in the top half, then the region, then four bits per terrain cost
+    std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(goal)) << 32)
+        | (static_cast<std::uint64_t>(region & 0xffff) << 16);
+    for (int terrain = 0; terrain < TERRAIN_TYPE_COUNT; ++terrain) {
+        key |= static_cast<std::uint64_t>(costs.enterCost[terrain] & 0xf) << (4 * terrain);
+    }
+    return key;
+}
+
+void PathCache::checkRevision(const NavigationGrid& grid) {
+    if (grid.getRevision() != mRevision) {
+        clear();
+        mRevision = grid.getRevision();
+    }
+}
+
+const std::vector<int>* PathCache::find(const NavigationGrid& grid, int region, int goal, const MovementCosts& costs) {
+    checkRevision(grid);
+    auto it = mIndex.find(makeKey(region, goal, costs));
+    if (it == mIndex.end()) {
+        ++mMisses;
+        return nullptr;
+    }
+    ++mHits;
+    mRoutes.splice(mRoutes.begin(), mRoutes, it->second);
+    return &it->second->waypoints;
+}
+
+void PathCache::insert(const NavigationGrid& grid, int region, int goal, const MovementCosts& costs,
+                       const std::vector<int>& waypoints, const std::vector<int>& tiles) {
+    checkRevision(grid);
+    std::uint64_t key = makeKey(region, goal, costs);
+    auto it = mIndex.find(key);
+    if (it != mIndex.end()) {
+        erase(it->second);
+    } else if (mRoutes.size() >= MAX_ROUTES) {
+        erase(std::prev(mRoutes.end()));
+    }
+    
+    // Each tile once, so a route has one entry per tile in mUsers
+    mRoutes.push_front({key, waypoints, tiles});
+    std::vector<int>& used = mRoutes.front().tiles;
+    std::sort(used.begin(), used.end());
+    used.erase(std::unique(used.begin(), used.end()), used.end());
+    mIndex[key] = mRoutes.begin();
+    for (int tile : used) {
+        mUsers[tile].push_back(key);
+    }
+}
+
+void PathCache::erase(std::list<Entry>::iterator it) {
+    for (int tile : it->tiles) {
+        auto users = mUsers.find(tile);
+        if (users == mUsers.end()) {
+            continue;
+        }
+        
+        std::vector<std::uint64_t>& keys = users->second;
+        auto key = std::find(keys.begin(), keys.end(), it->key);
+        if (key != keys.end()) {
+            *key = keys.back();
+            keys.pop_back();
+        }
+        if (keys.empty()) {
+            mUsers.erase(users);
+        }
+    }
+    mIndex.erase(it->key);
+    mRoutes.erase(it);
+}
+
+void PathCache::onTileChanged(int tile, NavigationChange change) {
+    if (change == NavigationChange::Unit) {
+        return;
+    }
+    
+    auto users = mUsers.find(tile);
+    if (users == mUsers.end()) {
+        return;
+    }
+    
+    // erase edits this tile's list, so work from a copy
+    std::vector<std::uint64_t> keys = users->second;
+    for (std::uint64_t key : keys) {
+        auto it = mIndex.find(key);
+        if (it != mIndex.end()) {
+            erase(it->second);
+            ++mInvalidations;
+        }
+    }
+}
+
+void PathCache::clear() {
+    mRoutes.clear();
+    mIndex.clear();
+    mUsers.clear();
+}
@@ -0,0 +1,96 @@
+#include "../../include/pathfinding/PathRequestService.h"
+#include <algorithm>
+
+PathRequestService::PathRequestService(unsigned workerCount) {
+    if (workerCount == 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        workerCount = cores > 3 ? cores - 2 : 1;
+    }
+    for (unsigned i = 0; i < workerCount; ++i) {
+        mWorkers.emplace_back(&PathRequestService::run, this);
+    }
+}
+
+PathRequestService::~PathRequestService() {
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+    }
+    mWake.notify_all();
+    for (auto& worker : mWorkers) {
+        worker.join();
+    }
+}
+
+void PathRequestService::submit(const PathRequest& request) {
+    mQueued.push_back(request);
+}
+
+void PathRequestService::update(const NavigationGrid& grid, sf::Time budget,
+                                const std::function<void(const PathResult&)>& apply) {
+    sf::Clock clock;
+    bool idle;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (auto& result : mFinished) {
+            mReady.push_back(std::move(result));
+        }
+        mFinished.clear();
+        idle = mInFlight == 0;
+    }
+    
+    // Nobody is reading the frame or the graphs now, so both can change
+    if (idle && !mQueued.empty()) {
+        mFrame.copyFrom(grid);
+        for (const PathRequest& request : mQueued) {
+            request.hierarchy->refresh(mFrame);
+        }
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mBatch.swap(mQueued);
+            mNextRequest = 0;
+            mInFlight = mBatch.size();
+        }
+        mQueued.clear();
+        mWake.notify_all();
+    }
+    
+    while (mReadyHead < mReady.size() && clock.getElapsedTime() < budget) {
+        apply(mReady[mReadyHead++]);
+        ++mCompleted;
+    }
+    if (mReadyHead == mReady.size()) {
+        mReady.clear();
+        mReadyHead = 0;
+    }
+}
+
+std::size_t PathRequestService::getPendingCount() const {
+    std::lock_guard<std::mutex> lock(mMutex);
+    return mQueued.size() + mInFlight + mFinished.size() + (mReady.size() - mReadyHead);
+}
+
+void PathRequestService::run() {
+    HierarchicalPathfinder::Query query;
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true) {
+        mWake.wait(lock, [this]() { return mStopping || mNextRequest < mBatch.size(); });
+        if (mStopping) {
+            return;
+        }
+        PathRequest request = mBatch[mNextRequest++];
+        lock.unlock();
+        
+        PathResult result;
+        result.unit = request.unit;
+        result.start = request.start;
+        result.goal = request.goal;
+        result.hierarchy = request.hierarchy;
+        result.found = request.hierarchy->findWaypoints(mFrame, request.start, request.goal, result.waypoints, query)
+            && request.hierarchy->traceRoute(mFrame, request.start, result.waypoints, result.tiles, query);
+        
+        lock.lock();
+        mFinished.push_back(std::move(result));
+        --mInFlight;
+    }
+}
@@ -0,0 +1,107 @@
+#include "../../include/pathfinding/Pathfinder.h"
+#include <algorithm>
+
+namespace {
+    // Min-heap on priority; among equal priorities prefer the tile furthest
+    // along, which keeps A* from fanning out across open terrain
+    struct OpenNodeAfter {
+        template <typename Node>
+        bool operator()(const Node& a, const Node& b) const {
+            if (a.priority != b.priority) {
+                return a.priority > b.priority;
+            }
+            return a.cost < b.cost;
+        }
+    };
+}
+
+void Pathfinder::beginSearch(int tileCount) {
+    if (static_cast<int>(mSearchOf.size()) != tileCount) {
+        mCost.assign(tileCount, 0);
+        mParent.assign(tileCount, -1);
+        mSearchOf.assign(tileCount, 0);
+        mSearch = 0;
+    }
+    
+    // Stamps wrap after four billion searches; start over rather than alias
+    if (++mSearch == 0) {
+        std::fill(mSearchOf.begin(), mSearchOf.end(), 0);
+        mSearch = 1;
+    }
+    mOpen.clear();
+    mNodesExpanded = 0;
+    mPathCost = 0;
+}
+
+bool Pathfinder::findPath(const NavigationGrid& grid, int start, int goal, const MovementCosts& costs,
+                          Allegiance faction, std::vector<int>& path, const LandmarkTable* landmarks) {
+    path.clear();
+    int tileCount = grid.getTileCount();
+    if (start < 0 || goal < 0 || start >= tileCount || goal >= tileCount || start == goal) {
+        return false;
+    }
+    if (!costs.canEnter(grid.getTerrain(goal)) || grid.hasUnit(goal)) {
+        return false;
+    }
+    
+    if (landmarks && (!landmarks->isValid() || landmarks->getCosts() != costs)) {
+        landmarks = nullptr;
+    }
+    auto heuristic = [&](int tile) {
+        int estimate = grid.distance(tile, goal) * costs.minCost;
+        return landmarks ? std::max(estimate, landmarks->lowerBound(grid, tile, goal)) : estimate;
+    };
+    
+    beginSearch(tileCount);
+    mCost[start] = 0;
+    mParent[start] = -1;
+    mSearchOf[start] = mSearch;
+    mOpen.push_back({heuristic(start), 0, start});
+    
+    OpenNodeAfter after;
+    while (!mOpen.empty()) {
+        std::pop_heap(mOpen.begin(), mOpen.end(), after);
+        OpenNode node = mOpen.back();
+        mOpen.pop_back();
+        
+        // A cheaper way here was found after this entry was pushed
+        if (node.cost != mCost[node.tile]) {
+            continue;
+        }
+        ++mNodesExpanded;
+        
+        if (node.tile == goal) {
+            mPathCost = node.cost;
+            for (int tile = goal; tile != start; tile = mParent[tile]) {
+                path.push_back(tile);
+            }
+            std::reverse(path.begin(), path.end());
+            return true;
+        }
+        
+        for (int direction = 0; direction < 6; ++direction) {
+            int next = grid.getNeighbor(node.tile, direction);
+            if (next < 0) {
+                continue;
+            }
+            
+            TerrainType terrain = grid.getTerrain(next);
+            if (!costs.canEnter(terrain) || grid.hasUnit(next)
+                || (next != goal && grid.isBlockedFor(next, faction))) {
+                continue;
+            }
+            
+            int cost = node.cost + costs.getCost(terrain);
+            if (mSearchOf[next] == mSearch && cost >= mCost[next]) {
+                continue;
+            }
+            mSearchOf[next] = mSearch;
+            mCost[next] = cost;
+            mParent[next] = node.tile;
+            mOpen.push_back({cost + heuristic(next), cost, next});
+            std::push_heap(mOpen.begin(), mOpen.end(), after);
+        }
+    }
+    
+    return false;
+}
@@ -0,0 +1,111 @@
+#include "../../include/pathfinding/ReservationTable.h"
+#include <algorithm>
+
+ReservationTable::ReservationTable(std::size_t maxAgents) {
+    mBucketSize = 16;
+    while (mBucketSize < maxAgents * 2) {
+        mBucketSize *= 2;
+    }
+    mSlots.assign(mBucketSize * HORIZON, Slot());
+    mBucketCounts.assign(HORIZON, 0);
+}
+
+void ReservationTable::advanceTo(std::uint64_t step) {
+    if (step <= mStep) {
+        return;
+    }
+    
+    // Past a whole window everything is stale
+    std::uint64_t first = std::max(mStep, step >= HORIZON ? step - HORIZON : 0);
+    for (std::uint64_t past = first; past < step; ++past) {
+        clearBucket(past);
+    }
+    mStep = step;
+}
+
+void ReservationTable::clearBucket(std::uint64_t step) {
+    std::size_t bucket = static_cast<std::size_t>(step % HORIZON);
+    if (mBucketCounts[bucket] == 0) {
+        return;
+    }
+    std::fill(mSlots.begin() + bucket * mBucketSize, mSlots.begin() + (bucket + 1) * mBucketSize, Slot());
+    mBucketCounts[bucket] = 0;
+}
+
+bool ReservationTable::reserve(int tile, std::uint64_t step, std::uint32_t owner) {
+    if (!inWindow(step) || tile < 0 || owner == NO_OWNER) {
+        return false;
+    }
+    
+    Slot* slots = bucketFor(step);
+    std::size_t mask = mBucketSize - 1;
+    for (std::size_t i = slotFor(tile), probes = 0; probes < mBucketSize; i = (i + 1) & mask, ++probes) {
+        if (slots[i].tile == tile) {
+            return slots[i].owner == owner;
+        }
+        if (slots[i].tile < 0) {
+            // Keep at least one empty slot so lookups always terminate
+            std::uint32_t& count = mBucketCounts[step % HORIZON];
+            if (count + 1 >= mBucketSize) {
+                return false;
+            }
+            slots[i] = {tile, owner};
+            ++count;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ReservationTable::release(int tile, std::uint64_t step, std::uint32_t owner) {
+    if (!inWindow(step) || tile < 0) {
+        return;
+    }
+    
+    Slot* slots = bucketFor(step);
+    std::size_t mask = mBucketSize - 1;
+    std::size_t i = slotFor(tile);
+    while (slots[i].tile >= 0 && slots[i].tile != tile) {
+        i = (i + 1) & mask;
+    }
+    if (slots[i].tile != tile || slots[i].owner != owner) {
+        return;
+    }
+    
+    // Backward-shift deletion: pull later entries of the probe run into the
+    // hole when their home slot allows it, so no tombstones are needed
+    std::size_t hole = i;
+    for (std::size_t next = (hole + 1) & mask; slots[next].tile >= 0; next = (next + 1) & mask) {
+        std::size_t home = slotFor(slots[next].tile);
+        bool movable = hole <= next ? (home <= hole || home > next) : (home <= hole && home > next);
+        if (movable) {
+            slots[hole] = slots[next];
+            hole = next;
+        }
+    }
+    slots[hole] = Slot();
+    --mBucketCounts[step % HORIZON];
+}
+
+std::uint32_t ReservationTable::getOwner(int tile, std::uint64_t step) const {
+    if (!inWindow(step) || tile < 0) {
+        return NO_OWNER;
+    }
+    
+    const Slot* slots = bucketFor(step);
+    std::size_t mask = mBucketSize - 1;
+    for (std::size_t i = slotFor(tile); slots[i].tile >= 0; i = (i + 1) & mask) {
+        if (slots[i].tile == tile) {
+            return slots[i].owner;
+        }
+    }
+    return NO_OWNER;
+}
+
+std::size_t ReservationTable::getReservationCount() const {
+    std::size_t count = 0;
+    for (std::uint32_t bucketCount : mBucketCounts) {
+        count += bucketCount;
+    }
+    return count;
+}
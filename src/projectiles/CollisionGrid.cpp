@@ -0,0 +1,187 @@
+#include "../../include/projectiles/CollisionGrid.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    constexpr float NEVER = std::numeric_limits<float>::infinity();
+
+    // Clip the step from + delta * t, t in [enter, exit], to the slab
+    // [min, max] on one axis; false if nothing of it is left
+    bool clipAxis(float start, float delta, float min, float max, float& enter, float& exit, bool touching) {
+        if (delta == 0.0f) {
+            return touching ? start >= min && start <= max : start > min && start < max;
+        }
+        float t0 = (min - start) / delta;
+        float t1 = (max - start) / delta;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+        }
+        enter = std::max(enter, t0);
+        exit = std::min(exit, t1);
+        return touching ? enter <= exit : enter < exit;
+    }
+
+    // Time in [0, 1] at which a box of halfSize moving along the step first
+    // overlaps bounds, or a negative value if it doesn't during the step.
+    // Boxes that only share an edge don't overlap, as with findIntersection.
+    float sweep(const sf::Vector2f& from, const sf::Vector2f& delta, float halfSize, const sf::FloatRect& bounds) {
+        float enter = 0.0f;
+        float exit = 1.0f;
+        if (!clipAxis(from.x, delta.x, bounds.position.x - halfSize, bounds.position.x + bounds.size.x + halfSize,
+                      enter, exit, false)
+            || !clipAxis(from.y, delta.y, bounds.position.y - halfSize, bounds.position.y + bounds.size.y + halfSize,
+                         enter, exit, false)) {
+            return -1.0f;
+        }
+        return enter;
+    }
+}
+
+CollisionGrid::CollisionGrid(float cellSize, float reach)
+    : mCellSize(cellSize), mReach(reach) {
+}
+
+void CollisionGrid::begin() {
+    mBounds.clear();
+    mAllegiance.clear();
+    mAlive.clear();
+    mTests = 0;
+}
+
+std::uint32_t CollisionGrid::add(const sf::FloatRect& bounds, Allegiance allegiance) {
+    mBounds.push_back(bounds);
+    mAllegiance.push_back(allegiance);
+    mAlive.push_back(1);
+    return static_cast<std::uint32_t>(mBounds.size() - 1);
+}
+
+int CollisionGrid::getColumn(float x) const {
+    return std::clamp(static_cast<int>(std::floor((x - mOrigin.x) / mCellSize)), 0, mColumns - 1);
+}
+
+int CollisionGrid::getRow(float y) const {
+    return std::clamp(static_cast<int>(std::floor((y - mOrigin.y) / mCellSize)), 0, mRows - 1);
+}
+
+void CollisionGrid::build() {
+    // Only the area the grown target boxes cover gets cells; a step outside
+    // it can't hit anything
+    mColumns = 0;
+    mRows = 0;
+    mCellTargets.clear();
+    if (mBounds.empty()) {
+        mCellStart.assign(1, 0);
+        return;
+    }
+    sf::Vector2f min(NEVER, NEVER);
+    sf::Vector2f max(-NEVER, -NEVER);
+    for (const sf::FloatRect& bounds : mBounds) {
+        min.x = std::min(min.x, bounds.position.x);
+        min.y = std::min(min.y, bounds.position.y);
+        max.x = std::max(max.x, bounds.position.x + bounds.size.x);
+        max.y = std::max(max.y, bounds.position.y + bounds.size.y);
+    }
+    mOrigin = min - sf::Vector2f(mReach, mReach);
+    mColumns = static_cast<int>(std::floor((max.x + mReach - mOrigin.x) / mCellSize)) + 1;
+    mRows = static_cast<int>(std::floor((max.y + mReach - mOrigin.y) / mCellSize)) + 1;
+    mCellStart.assign(static_cast<std::size_t>(mColumns) * mRows + 1, 0);
+
+    // Counting sort: count entries per cell, turn the counts into start
+    // offsets, then place every target, in order, into its cells
+    auto forEachCell = [this](const sf::FloatRect& bounds, auto&& visit) {
+        int column0 = getColumn(bounds.position.x - mReach);
+        int column1 = getColumn(bounds.position.x + bounds.size.x + mReach);
+        int row0 = getRow(bounds.position.y - mReach);
+        int row1 = getRow(bounds.position.y + bounds.size.y + mReach);
+        for (int row = row0; row <= row1; ++row) {
+            for (int column = column0; column <= column1; ++column) {
+                visit(row * mColumns + column);
+            }
+        }
+    };
+
+    for (const sf::FloatRect& bounds : mBounds) {
+        forEachCell(bounds, [this](int cell) { mCellStart[cell + 1]++; });
+    }
+    for (std::size_t cell = 1; cell < mCellStart.size(); ++cell) {
+        mCellStart[cell] += mCellStart[cell - 1];
+    }
+
+    mCellTargets.resize(mCellStart.back());
+    for (std::uint32_t target = 0; target < mBounds.size(); ++target) {
+        // mCellStart[c] is used as the write cursor and ends up at the old
+        // mCellStart[c + 1]; shifted back below
+        forEachCell(mBounds[target], [this, target](int cell) { mCellTargets[mCellStart[cell]++] = target; });
+    }
+    for (std::size_t cell = mCellStart.size() - 1; cell > 0; --cell) {
+        mCellStart[cell] = mCellStart[cell - 1];
+    }
+    mCellStart[0] = 0;
+}
+
+CollisionGrid::Hit CollisionGrid::findFirstHit(const sf::Vector2f& from, const sf::Vector2f& to, float halfSize,
+                                               Allegiance allegiance) const {
+    Hit hit;
+    if (mColumns == 0) {
+        return hit;
+    }
+
+    // Only the part of the step over the cells matters
+    sf::Vector2f delta = to - from;
+    float enter = 0.0f;
+    float exit = 1.0f;
+    sf::Vector2f gridEnd = mOrigin + sf::Vector2f(mColumns * mCellSize, mRows * mCellSize);
+    if (!clipAxis(from.x, delta.x, mOrigin.x, gridEnd.x, enter, exit, true)
+        || !clipAxis(from.y, delta.y, mOrigin.y, gridEnd.y, enter, exit, true)) {
+        return hit;
+    }
+
+    // Walk the cells the segment crosses in order (Amanatides-Woo). tNextX
+    // and tNextY are the step times at which it crosses into the next column
+    // and row.
+    sf::Vector2f entry = from + delta * enter;
+    int column = getColumn(entry.x);
+    int row = getRow(entry.y);
+    int stepX = delta.x > 0.0f ? 1 : (delta.x < 0.0f ? -1 : 0);
+    int stepY = delta.y > 0.0f ? 1 : (delta.y < 0.0f ? -1 : 0);
+    float tDeltaX = stepX != 0 ? mCellSize / std::abs(delta.x) : NEVER;
+    float tDeltaY = stepY != 0 ? mCellSize / std::abs(delta.y) : NEVER;
+    float tNextX = stepX != 0 ? (mOrigin.x + (column + (stepX > 0)) * mCellSize - from.x) / delta.x : NEVER;
+    float tNextY = stepY != 0 ? (mOrigin.y + (row + (stepY > 0)) * mCellSize - from.y) / delta.y : NEVER;
+
+    while (true) {
+        int cell = row * mColumns + column;
+        for (std::uint32_t i = mCellStart[cell]; i < mCellStart[cell + 1]; ++i) {
+            std::uint32_t target = mCellTargets[i];
+            if (!mAlive[target] || mAllegiance[target] == allegiance) {
+                continue;
+            }
+            mTests++;
+            float time = sweep(from, delta, halfSize, mBounds[target]);
+            if (time >= 0.0f && (time < hit.time || (time == hit.time && target < hit.target))) {
+                hit.target = target;
+                hit.time = time;
+            }
+        }
+
+        // A target first touched inside this cell is filed under it, so once
+        // the best hit is earlier than leaving the cell nothing further on
+        // can beat it
+        float cellExit = std::min(tNextX, tNextY);
+        if (cellExit >= exit || (hit.target != NO_TARGET && hit.time < cellExit)) {
+            break;
+        }
+        if (tNextX < tNextY) {
+            column += stepX;
+            tNextX += tDeltaX;
+        } else {
+            row += stepY;
+            tNextY += tDeltaY;
+        }
+        if (column < 0 || column >= mColumns || row < 0 || row >= mRows) {
+            break;
+        }
+    }
+    return hit;
+}
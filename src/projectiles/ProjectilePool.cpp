@@ -0,0 +1,151 @@
+#include "../../include/projectiles/ProjectilePool.h"
+#include "../../include/graphics/TextureManager.h"
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+namespace {
+    // Filled circle in the type's color, for when its texture is missing
+    const sf::Texture* createFallbackTexture(ProjectileType type, sf::Color color) {
+        if (!TextureManager::getInstance().areTexturesEnabled()) {
+            return nullptr;
+        }
+        
+        sf::Image image(sf::Vector2u(16, 16), sf::Color::Transparent);
+        for (unsigned int x = 0; x < 16; ++x) {
+            for (unsigned int y = 0; y < 16; ++y) {
+                float dx = static_cast<float>(x) - 8.0f;
+                float dy = static_cast<float>(y) - 8.0f;
+                if (dx * dx + dy * dy <= 64.0f) {
+                    image.setPixel(sf::Vector2u(x, y), color);
+                }
+            }
+        }
+
+        sf::Texture texture;
+        if (!texture.loadFromImage(image)) {
+            std::cerr << "ProjectilePool: Failed to create fallback texture" << std::endl;
+            return nullptr;
+        }
+        std::string name = "projectile_" + std::to_string(static_cast<int>(type));
+        return TextureManager::getInstance().addTexture(name, std::move(texture));
+    }
+}
+
+ProjectilePool::ProjectilePool()
+    : mPositionX(CAPACITY), mPositionY(CAPACITY),
+      mPreviousX(CAPACITY), mPreviousY(CAPACITY),
+      mVelocityX(CAPACITY), mVelocityY(CAPACITY),
+      mDamage(CAPACITY), mLifetime(CAPACITY),
+      mAllegiance(CAPACITY), mType(CAPACITY) {
+}
+
+void ProjectilePool::loadTextures() {
+    for (int type = 0; type < PROJECTILE_TYPE_COUNT; ++type) {
+        const ProjectileStats& stats = PROJECTILE_STATS[type];
+        if (!stats.texture || mTextures[type]) {
+            continue;
+        }
+        if (std::filesystem::exists(stats.texture)) {
+            mTextures[type] = TextureManager::getInstance().getTexture(stats.texture);
+        }
+        if (!mTextures[type]) {
+            mTextures[type] = createFallbackTexture(static_cast<ProjectileType>(type), stats.color);
+        }
+    }
+}
+
+bool ProjectilePool::spawn(const ProjectileShot& shot) {
+    const ProjectileStats& stats = projectileStatsOf(shot.type);
+    if (!stats.texture) {
+        return false;
+    }
+    if (mCount == CAPACITY) {
+        mDropped++;
+        return false;
+    }
+
+    std::size_t i = mCount++;
+    mPositionX[i] = shot.position.x;
+    mPositionY[i] = shot.position.y;
+    mPreviousX[i] = shot.position.x;
+    mPreviousY[i] = shot.position.y;
+    mVelocityX[i] = shot.direction.x * stats.speed;
+    mVelocityY[i] = shot.direction.y * stats.speed;
+    mDamage[i] = stats.damage;
+    mLifetime[i] = stats.lifetime;
+    mAllegiance[i] = shot.allegiance;
+    mType[i] = shot.type;
+    return true;
+}
+
+void ProjectilePool::update(float deltaTime) {
+    const std::size_t count = mCount;
+
+    // Plain loops over flat arrays, so the compiler can vectorize them
+    float* positionX = mPositionX.data();
+    float* positionY = mPositionY.data();
+    float* previousX = mPreviousX.data();
+    float* previousY = mPreviousY.data();
+    const float* velocityX = mVelocityX.data();
+    const float* velocityY = mVelocityY.data();
+    float* lifetime = mLifetime.data();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        previousX[i] = positionX[i];
+        previousY[i] = positionY[i];
+        positionX[i] += velocityX[i] * deltaTime;
+        positionY[i] += velocityY[i] * deltaTime;
+        lifetime[i] -= deltaTime;
+    }
+
+    // Compact out the expired ones
+    for (std::size_t i = 0; i < mCount;) {
+        if (mLifetime[i] <= 0.0f) {
+            kill(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+void ProjectilePool::kill(std::size_t index) {
+    std::size_t last = --mCount;
+    if (index != last) {
+        mPositionX[index] = mPositionX[last];
+        mPositionY[index] = mPositionY[last];
+        mPreviousX[index] = mPreviousX[last];
+        mPreviousY[index] = mPreviousY[last];
+        mVelocityX[index] = mVelocityX[last];
+        mVelocityY[index] = mVelocityY[last];
+        mDamage[index] = mDamage[last];
+        mLifetime[index] = mLifetime[last];
+        mAllegiance[index] = mAllegiance[last];
+        mType[index] = mType[last];
+    }
+}
+
+void ProjectilePool::captureRenderState(std::vector<SpriteCommand>& sprites, bool asSprite) const {
+    for (std::size_t i = 0; i < mCount; ++i) {
+        const sf::Texture* texture = asSprite ? mTextures[static_cast<int>(mType[i])] : nullptr;
+        sf::Vector2f position(mPositionX[i], mPositionY[i]);
+
+        if (!texture) {
+            // Flat quads all batch into one draw regardless of projectile type
+            sf::Transform transform;
+            transform.translate(position - sf::Vector2f(3.f, 3.f));
+            sprites.push_back({nullptr, sf::IntRect(), {6.f, 6.f}, transform,
+                               projectileStatsOf(mType[i]).color, RenderLayer::Projectiles});
+            continue;
+        }
+
+        // Scale the whole texture to the type's size, centered on the position
+        float size = projectileStatsOf(mType[i]).size;
+        sf::Vector2f textureSize(texture->getSize());
+        sf::Transform transform;
+        transform.translate(position - sf::Vector2f(size / 2.0f, size / 2.0f));
+        transform.scale({size / textureSize.x, size / textureSize.y});
+        sprites.push_back({texture, sf::IntRect({0, 0}, sf::Vector2i(texture->getSize())), textureSize,
+                           transform, sf::Color::White, RenderLayer::Projectiles});
+    }
+}
@@ -29,4 +29,14 @@ void Resource::doRender(sf::RenderWindow& window) const {
         shape.setOrigin({10.f, 10.f}); // Center origin
         window.draw(shape);
     }
-} 
\ No newline at end of file
+} 
+void Resource::doCaptureRenderState(std::vector<SpriteCommand>& sprites, RenderLayer layer) const {
+    // Mirror doRender: the sprite if there is one, otherwise a magenta placeholder
+    if (hasSprite()) {
+        GameObject::doCaptureRenderState(sprites, layer);
+    } else {
+        sf::Transform transform;
+        transform.translate(getPosition() - sf::Vector2f(10.f, 10.f));
+        sprites.push_back({nullptr, sf::IntRect(), {20.f, 20.f}, transform, sf::Color::Magenta, layer});
+    }
+}
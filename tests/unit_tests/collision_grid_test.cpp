@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "projectiles/CollisionGrid.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+    sf::FloatRect box(float x, float y, float size) {
+        return sf::FloatRect({x, y}, {size, size});
+    }
+
+    // First overlap of a swept box with each target in turn, as a reference
+    CollisionGrid::Hit sweepAll(const sf::Vector2f& from, const sf::Vector2f& to, float halfSize, Allegiance allegiance,
+                                const std::vector<sf::FloatRect>& targets, const std::vector<Allegiance>& sides) {
+        CollisionGrid::Hit hit;
+        sf::Vector2f delta = to - from;
+        for (std::uint32_t target = 0; target < targets.size(); ++target) {
+            if (sides[target] == allegiance) {
+                continue;
+            }
+            const sf::FloatRect& bounds = targets[target];
+            float enter = 0.f;
+            float exit = 1.f;
+            bool overlaps = true;
+            const float start[2] = {from.x, from.y};
+            const float step[2] = {delta.x, delta.y};
+            const float min[2] = {bounds.position.x - halfSize, bounds.position.y - halfSize};
+            const float max[2] = {bounds.position.x + bounds.size.x + halfSize, bounds.position.y + bounds.size.y + halfSize};
+            for (int axis = 0; axis < 2 && overlaps; ++axis) {
+                if (step[axis] == 0.f) {
+                    overlaps = start[axis] > min[axis] && start[axis] < max[axis];
+                    continue;
+                }
+                float t0 = (min[axis] - start[axis]) / step[axis];
+                float t1 = (max[axis] - start[axis]) / step[axis];
+                enter = std::max(enter, std::min(t0, t1));
+                exit = std::min(exit, std::max(t0, t1));
+                overlaps = enter < exit;
+            }
+            if (overlaps && enter < hit.time) {
+                hit.target = target;
+                hit.time = enter;
+            }
+        }
+        return hit;
+    }
+}
+
+TEST(CollisionGridTest, EmptyGridHitsNothing) {
+    CollisionGrid grid(50.f, 5.f);
+    grid.begin();
+    grid.build();
+    EXPECT_EQ(grid.findFirstHit({0.f, 0.f}, {100.f, 100.f}, 2.f, Allegiance::FRIENDLY).target, CollisionGrid::NO_TARGET);
+}
+
+TEST(CollisionGridTest, FastStepCannotTunnelThroughTarget) {
+    CollisionGrid grid(50.f, 5.f);
+    grid.begin();
+    grid.add(box(495.f, -5.f, 10.f), Allegiance::ENEMY);
+    grid.build();
+
+    // Starts and ends far from the target, crossing it in the middle
+    CollisionGrid::Hit hit = grid.findFirstHit({0.f, 0.f}, {1000.f, 0.f}, 2.f, Allegiance::FRIENDLY);
+    ASSERT_EQ(hit.target, 0u);
+    EXPECT_NEAR(hit.time, 493.f / 1000.f, 1e-5f);
+}
+
+TEST(CollisionGridTest, SkipsOwnSideAndRemovedTargets) {
+    CollisionGrid grid(50.f, 5.f);
+    grid.begin();
+    std::uint32_t friendly = grid.add(box(100.f, -5.f, 10.f), Allegiance::FRIENDLY);
+    std::uint32_t first = grid.add(box(200.f, -5.f, 10.f), Allegiance::ENEMY);
+    std::uint32_t second = grid.add(box(300.f, -5.f, 10.f), Allegiance::ENEMY);
+    grid.build();
+
+    EXPECT_EQ(grid.findFirstHit({0.f, 0.f}, {400.f, 0.f}, 2.f, Allegiance::FRIENDLY).target, first);
+    EXPECT_EQ(grid.findFirstHit({0.f, 0.f}, {400.f, 0.f}, 2.f, Allegiance::ENEMY).target, friendly);
+    grid.remove(first);
+    EXPECT_EQ(grid.findFirstHit({0.f, 0.f}, {400.f, 0.f}, 2.f, Allegiance::FRIENDLY).target, second);
+}
+
+TEST(CollisionGridTest, TiesGoToLowestNumberedTarget) {
+    CollisionGrid grid(50.f, 5.f);
+    grid.begin();
+    grid.add(box(100.f, 0.f, 10.f), Allegiance::ENEMY);
+    grid.add(box(100.f, -10.f, 10.f), Allegiance::ENEMY);
+    grid.build();
+
+    // Runs along the edge both boxes share, touching both at once
+    CollisionGrid::Hit hit = grid.findFirstHit({0.f, 0.f}, {200.f, 0.f}, 2.f, Allegiance::FRIENDLY);
+    EXPECT_EQ(hit.target, 0u);
+}
+
+TEST(CollisionGridTest, FirstHitMatchesSweepingEveryTarget) {
+    std::mt19937 random(7);
+    std::uniform_real_distribution<float> coordinate(0.f, 2000.f);
+    std::uniform_real_distribution<float> size(5.f, 30.f);
+    std::uniform_real_distribution<float> halfSize(0.5f, 5.f);
+    std::uniform_real_distribution<float> length(-400.f, 400.f);
+
+    CollisionGrid grid(50.f, 5.f);
+    std::vector<sf::FloatRect> targets;
+    std::vector<Allegiance> sides;
+    int hits = 0;
+    for (int round = 0; round < 20; ++round) {
+        grid.begin();
+        targets.clear();
+        sides.clear();
+        for (int i = 0; i < 300; ++i) {
+            targets.push_back(box(coordinate(random), coordinate(random), size(random)));
+            sides.push_back(i % 2 ? Allegiance::ENEMY : Allegiance::FRIENDLY);
+            grid.add(targets.back(), sides.back());
+        }
+        grid.build();
+
+        for (int query = 0; query < 500; ++query) {
+            sf::Vector2f from(coordinate(random), coordinate(random));
+            // Some steps are axis-aligned or don't move at all
+            sf::Vector2f delta(length(random), length(random));
+            if (query % 10 == 0) delta.x = 0.f;
+            if (query % 10 == 1) delta.y = 0.f;
+            if (query % 50 == 2) delta = {0.f, 0.f};
+            float half = halfSize(random);
+            Allegiance side = query % 2 ? Allegiance::ENEMY : Allegiance::FRIENDLY;
+
+            CollisionGrid::Hit expected = sweepAll(from, from + delta, half, side, targets, sides);
+            CollisionGrid::Hit actual = grid.findFirstHit(from, from + delta, half, side);
+            ASSERT_EQ(actual.target == CollisionGrid::NO_TARGET, expected.target == CollisionGrid::NO_TARGET)
+                << "round " << round << " query " << query;
+            if (expected.target != CollisionGrid::NO_TARGET) {
+                // Targets touched at the same time may come back in either order
+                EXPECT_EQ(actual.time, expected.time) << "round " << round << " query " << query;
+                hits++;
+            }
+        }
+    }
+    EXPECT_GT(hits, 100);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include "pathfinding/FlowField.h"
+#include "characters/MovementClass.h"
+#include "graphics/HexGrid.h"
+#include <random>
+
+TEST(FlowFieldTest, FollowingTheFieldReachesTheGoalDownhill) {
+    HexGrid hexes(20, 31u);
+    NavigationGrid grid(hexes);
+    const MovementCosts& costs = movementCostsOf(MovementClass::Infantry);
+    FlowFieldCache cache;
+    int goal = grid.getTileCount() / 2;
+    grid.setTerrain(goal, TerrainType::PLAINS);
+    const FlowField& field = cache.getField(grid, goal, costs, Allegiance::FRIENDLY);
+
+    int followed = 0;
+    for (int start = 0; start < grid.getTileCount(); ++start) {
+        if (!field.reaches(start) || start == goal || !costs.canEnter(grid.getTerrain(start))) {
+            continue;
+        }
+
+        // Each step pays the terrain entered, exactly what the field charged
+        int tile = start;
+        int steps = 0;
+        while (tile != goal) {
+            int next = field.getNextTile(grid, tile);
+            ASSERT_GE(next, 0) << "stuck at " << tile << " from " << start;
+            ASSERT_EQ(field.getCost(tile), field.getCost(next) + costs.getCost(grid.getTerrain(next)));
+            tile = next;
+            ASSERT_LE(++steps, grid.getTileCount());
+        }
+        followed++;
+    }
+    EXPECT_GT(followed, grid.getTileCount() / 2);
+    EXPECT_EQ(field.getNextTile(grid, goal), -1);
+}
+
+TEST(FlowFieldTest, StepsAroundUnitsButNeverUphill) {
+    HexGrid hexes(6, 1u);
+    NavigationGrid grid(hexes);
+    for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+        grid.setTerrain(tile, TerrainType::PLAINS);
+    }
+    const MovementCosts& costs = movementCostsOf(MovementClass::Infantry);
+    FlowFieldCache cache;
+    int goal = 0;
+    const FlowField& field = cache.getField(grid, goal, costs, Allegiance::FRIENDLY);
+
+    // Somewhere far enough that more than one neighbor leads closer
+    int start = -1;
+    for (int tile = 0; tile < grid.getTileCount() && start < 0; ++tile) {
+        int closer = 0;
+        for (int direction = 0; direction < 6; ++direction) {
+            int neighbor = grid.getNeighbor(tile, direction);
+            closer += neighbor >= 0 && field.getCost(neighbor) < field.getCost(tile);
+        }
+        if (closer >= 2) {
+            start = tile;
+        }
+    }
+    ASSERT_GE(start, 0);
+
+    int best = field.getNextTile(grid, start);
+    ASSERT_GE(best, 0);
+    grid.setUnit(best, true);
+    int around = field.getNextTile(grid, start);
+    ASSERT_GE(around, 0);
+    EXPECT_NE(around, best);
+    EXPECT_LT(field.getCost(around), field.getCost(start));
+
+    // With every way closer taken, the unit waits
+    for (int direction = 0; direction < 6; ++direction) {
+        int neighbor = grid.getNeighbor(start, direction);
+        if (neighbor >= 0 && field.getCost(neighbor) < field.getCost(start)) {
+            grid.setUnit(neighbor, true);
+        }
+    }
+    EXPECT_EQ(field.getNextTile(grid, start), -1);
+}
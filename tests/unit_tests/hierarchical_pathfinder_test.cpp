@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include "pathfinding/HierarchicalPathfinder.h"
+#include "characters/MovementClass.h"
+#include "graphics/HexGrid.h"
+#include <vector>
+
+namespace {
+    bool adjacent(const NavigationGrid& grid, int a, int b) {
+        for (int direction = 0; direction < 6; ++direction) {
+            if (grid.getNeighbor(a, direction) == b) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TEST(HierarchicalPathfinderTest, TracedRouteWalksFromStartToGoal) {
+    HexGrid hexes(40, 1u);
+    NavigationGrid grid(hexes);
+    for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+        grid.setTerrain(tile, TerrainType::PLAINS);
+    }
+    HierarchicalPathfinder hierarchy(movementCostsOf(MovementClass::Tracked));
+    hierarchy.refresh(grid);
+    HierarchicalPathfinder::Query query;
+    std::vector<int> waypoints;
+    std::vector<int> route;
+    int start = 0;
+    int goal = grid.getTileCount() - 1;
+
+    ASSERT_TRUE(hierarchy.findWaypoints(grid, start, goal, waypoints, query));
+    EXPECT_GT(query.nodesExpanded, 0);
+    ASSERT_TRUE(hierarchy.traceRoute(grid, start, waypoints, route, query));
+    ASSERT_FALSE(route.empty());
+    EXPECT_EQ(route.back(), goal);
+    EXPECT_TRUE(adjacent(grid, start, route.front()));
+    for (std::size_t i = 1; i < route.size(); ++i) {
+        EXPECT_TRUE(adjacent(grid, route[i - 1], route[i])) << "step " << i;
+    }
+}
+
+TEST(HierarchicalPathfinderTest, TraceFailsWhenALegIsCutOff) {
+    HexGrid hexes(40, 1u);
+    NavigationGrid grid(hexes);
+    for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+        grid.setTerrain(tile, TerrainType::PLAINS);
+    }
+    HierarchicalPathfinder hierarchy(movementCostsOf(MovementClass::Tracked));
+    hierarchy.refresh(grid);
+    HierarchicalPathfinder::Query query;
+    std::vector<int> waypoints;
+    std::vector<int> route;
+    int start = 0;
+    int goal = grid.getTileCount() - 1;
+    ASSERT_TRUE(hierarchy.findWaypoints(grid, start, goal, waypoints, query));
+
+    // The terrain changes after the waypoints were found: tanks can't enter
+    // the goal any more, so the last leg can't be walked
+    grid.setTerrain(goal, TerrainType::FOREST);
+    route.push_back(start);
+    EXPECT_FALSE(hierarchy.traceRoute(grid, start, waypoints, route, query));
+    EXPECT_TRUE(route.empty());
+}
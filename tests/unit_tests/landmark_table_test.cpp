@@ -0,0 +1,125 @@
+#include <gtest/gtest.h>
+#include "pathfinding/LandmarkTable.h"
+#include "characters/MovementClass.h"
+#include "graphics/HexGrid.h"
+#include <functional>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <vector>
+
+namespace {
+    constexpr int UNREACHED = -1;
+
+    // Exact terrain-only cost from one tile to every other, paying for each
+    // tile entered, which is what the landmarks have to bound
+    std::vector<int> costsFrom(const NavigationGrid& grid, int start, const MovementCosts& costs) {
+        std::vector<int> cost(grid.getTileCount(), UNREACHED);
+        using Node = std::pair<int, int>;
+        std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open;
+        cost[start] = 0;
+        open.push({0, start});
+        while (!open.empty()) {
+            auto [distance, tile] = open.top();
+            open.pop();
+            if (distance != cost[tile]) {
+                continue;
+            }
+            for (int direction = 0; direction < 6; ++direction) {
+                int next = grid.getNeighbor(tile, direction);
+                if (next < 0 || !costs.canEnter(grid.getTerrain(next))) {
+                    continue;
+                }
+                int nextCost = distance + costs.getCost(grid.getTerrain(next));
+                if (cost[next] == UNREACHED || nextCost < cost[next]) {
+                    cost[next] = nextCost;
+                    open.push({nextCost, next});
+                }
+            }
+        }
+        return cost;
+    }
+
+    class LandmarkTableTest : public ::testing::TestWithParam<MovementClass> {
+    protected:
+        HexGrid mHexes{20, 2024u};
+        NavigationGrid mGrid{mHexes};
+    };
+}
+
+TEST_P(LandmarkTableTest, LowerBoundNeverExceedsTrueCost) {
+    const MovementCosts& costs = movementCostsOf(GetParam());
+    LandmarkTable table(costs);
+    table.build(mGrid);
+    ASSERT_TRUE(table.isValid());
+    ASSERT_FALSE(table.getLandmarks().empty());
+
+    std::mt19937 random(3);
+    int tighter = 0;
+    int pairs = 0;
+    for (int sample = 0; sample < 60; ++sample) {
+        int tile = static_cast<int>(random() % mGrid.getTileCount());
+        if (!costs.canEnter(mGrid.getTerrain(tile))) {
+            continue;
+        }
+        std::vector<int> exact = costsFrom(mGrid, tile, costs);
+        for (int goal = 0; goal < mGrid.getTileCount(); ++goal) {
+            if (exact[goal] == UNREACHED) {
+                continue;
+            }
+            int bound = table.lowerBound(mGrid, tile, goal);
+            ASSERT_LE(bound, exact[goal]) << "from " << tile << " to " << goal;
+            pairs++;
+            if (bound > mGrid.distance(tile, goal) * costs.minCost) {
+                tighter++;
+            }
+        }
+    }
+
+    // Admissible is easy; the table is only worth having if it beats hex distance
+    ASSERT_GT(pairs, 0);
+    EXPECT_GT(tighter, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(MovementClasses, LandmarkTableTest,
+                         ::testing::Values(MovementClass::Infantry, MovementClass::Tracked));
+
+TEST(LandmarkTableStaleTest, TerrainChangeDropsTheBound) {
+    HexGrid hexes(10, 5u);
+    NavigationGrid grid(hexes);
+    LandmarkTable table(movementCostsOf(MovementClass::Infantry));
+    table.build(grid);
+    ASSERT_TRUE(table.isValid());
+
+    table.onTileChanged(0, NavigationChange::Unit);
+    EXPECT_TRUE(table.isValid());
+    table.onTileChanged(0, NavigationChange::Terrain);
+    EXPECT_FALSE(table.isValid());
+    EXPECT_EQ(table.lowerBound(grid, 0, grid.getTileCount() - 1), 0);
+}
+
+TEST(LandmarkTableStaleTest, StoredTablesOnlyLoadForTheSameTerrain) {
+    HexGrid hexes(10, 5u);
+    NavigationGrid grid(hexes);
+    const MovementCosts& costs = movementCostsOf(MovementClass::Infantry);
+    LandmarkTable table(costs);
+    table.build(grid);
+    std::stringstream stored;
+    table.write(stored);
+
+    LandmarkTable loaded(costs);
+    std::stringstream copy(stored.str());
+    ASSERT_TRUE(loaded.read(copy, grid));
+    EXPECT_EQ(loaded.getLandmarks(), table.getLandmarks());
+    for (int tile = 0; tile < grid.getTileCount(); tile += 7) {
+        EXPECT_EQ(loaded.lowerBound(grid, tile, 0), table.lowerBound(grid, tile, 0));
+    }
+
+    // One tile of different terrain and the stored tables no longer apply
+    int tile = grid.getTileCount() / 2;
+    grid.setTerrain(tile, grid.getTerrain(tile) == TerrainType::WATER ? TerrainType::PLAINS : TerrainType::WATER);
+    LandmarkTable stale(costs);
+    std::stringstream again(stored.str());
+    EXPECT_FALSE(stale.read(again, grid));
+    EXPECT_FALSE(stale.isValid());
+}
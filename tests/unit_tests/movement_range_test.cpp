@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "pathfinding/MovementRange.h"
+#include "characters/MovementClass.h"
+#include "graphics/HexGrid.h"
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr int OUT_OF_RANGE = -1;
+
+    // Relax every tile until nothing changes; a step may start from any tile
+    // reached with points left, and the start itself is never re-entered
+    std::vector<int> referenceRange(const NavigationGrid& grid, int start, int movePoints, const MovementCosts& costs,
+                                    Allegiance faction) {
+        std::vector<int> cost(grid.getTileCount(), OUT_OF_RANGE);
+        cost[start] = 0;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+                if (cost[tile] == OUT_OF_RANGE || cost[tile] >= movePoints) {
+                    continue;
+                }
+                for (int direction = 0; direction < 6; ++direction) {
+                    int next = grid.getNeighbor(tile, direction);
+                    if (next < 0 || next == start || !costs.canEnter(grid.getTerrain(next)) || grid.hasUnit(next)
+                        || grid.isBlockedFor(next, faction)) {
+                        continue;
+                    }
+                    int nextCost = cost[tile] + costs.getCost(grid.getTerrain(next));
+                    if (cost[next] == OUT_OF_RANGE || nextCost < cost[next]) {
+                        cost[next] = nextCost;
+                        changed = true;
+                    }
+                }
+            }
+        }
+        return cost;
+    }
+
+    int neighborOf(const NavigationGrid& grid, int tile) {
+        for (int direction = 0; direction < 6; ++direction) {
+            if (grid.getNeighbor(tile, direction) >= 0) {
+                return grid.getNeighbor(tile, direction);
+            }
+        }
+        return -1;
+    }
+}
+
+TEST(MovementRangeTest, MatchesRelaxationOnGeneratedMaps) {
+    HexGrid hexes(15, 11u);
+    NavigationGrid grid(hexes);
+    std::mt19937 random(5);
+
+    // Scatter units and buildings of both sides to route around
+    for (int i = 0; i < 60; ++i) {
+        grid.setUnit(static_cast<int>(random() % grid.getTileCount()), true);
+        grid.setBuilding(static_cast<int>(random() % grid.getTileCount()),
+                         static_cast<std::int8_t>(i % 2 ? Allegiance::ENEMY : Allegiance::FRIENDLY));
+    }
+
+    MovementRange range;
+    for (int sample = 0; sample < 40; ++sample) {
+        int start = static_cast<int>(random() % grid.getTileCount());
+        int movePoints = 1 + static_cast<int>(random() % 12);
+        MovementClass movementClass = sample % 2 ? MovementClass::Tracked : MovementClass::Infantry;
+        const MovementCosts& costs = movementCostsOf(movementClass);
+
+        range.compute(grid, start, movePoints, costs, Allegiance::FRIENDLY);
+        std::vector<int> expected = referenceRange(grid, start, movePoints, costs, Allegiance::FRIENDLY);
+
+        std::size_t reachable = 0;
+        for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+            if (tile == start) {
+                continue;
+            }
+            ASSERT_EQ(range.getCost(tile), expected[tile]) << "start " << start << " tile " << tile;
+            EXPECT_EQ(range.contains(tile), expected[tile] != OUT_OF_RANGE);
+            reachable += expected[tile] != OUT_OF_RANGE;
+        }
+        ASSERT_EQ(range.getTiles().size(), reachable);
+        for (std::size_t i = 1; i < range.getTiles().size(); ++i) {
+            EXPECT_LE(range.getCost(range.getTiles()[i - 1]), range.getCost(range.getTiles()[i]));
+        }
+        EXPECT_FALSE(range.contains(start));
+    }
+}
+
+TEST(MovementRangeTest, AnyPointLeftBuysOneStep) {
+    HexGrid hexes(3, 1u);
+    NavigationGrid grid(hexes);
+    int start = grid.getTileCount() / 2;
+    for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+        grid.setTerrain(tile, TerrainType::FOREST);
+    }
+
+    // Forest costs more than the single point left, but the step is still allowed
+    MovementRange range;
+    range.compute(grid, start, 1, movementCostsOf(MovementClass::Infantry), Allegiance::FRIENDLY);
+    int neighbor = neighborOf(grid, start);
+    ASSERT_GE(neighbor, 0);
+    EXPECT_EQ(range.getCost(neighbor), MovementCosts::TERRAIN_COSTS[static_cast<int>(TerrainType::FOREST)]);
+    for (int tile : range.getTiles()) {
+        EXPECT_EQ(grid.distance(start, tile), 1);
+    }
+
+    // Tracked units can't enter forest at all
+    range.compute(grid, start, 10, movementCostsOf(MovementClass::Tracked), Allegiance::FRIENDLY);
+    EXPECT_TRUE(range.getTiles().empty());
+}
+
+TEST(MovementRangeTest, OwnBuildingsPassEnemyBuildingsBlock) {
+    HexGrid hexes(3, 1u);
+    NavigationGrid grid(hexes);
+    for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+        grid.setTerrain(tile, TerrainType::PLAINS);
+    }
+    int start = grid.getTileCount() / 2;
+    int neighbor = neighborOf(grid, start);
+    const MovementCosts& costs = movementCostsOf(MovementClass::Infantry);
+
+    MovementRange range;
+    grid.setBuilding(neighbor, static_cast<std::int8_t>(Allegiance::FRIENDLY));
+    range.compute(grid, start, 4, costs, Allegiance::FRIENDLY);
+    EXPECT_TRUE(range.contains(neighbor));
+
+    grid.setBuilding(neighbor, static_cast<std::int8_t>(Allegiance::ENEMY));
+    range.compute(grid, start, 4, costs, Allegiance::FRIENDLY);
+    EXPECT_FALSE(range.contains(neighbor));
+
+    grid.setBuilding(neighbor, NavigationGrid::NO_OWNER);
+    grid.setUnit(neighbor, true);
+    range.compute(grid, start, 4, costs, Allegiance::FRIENDLY);
+    EXPECT_FALSE(range.contains(neighbor));
+}
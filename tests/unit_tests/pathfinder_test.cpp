@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include "pathfinding/Pathfinder.h"
+#include "pathfinding/LandmarkTable.h"
+#include "characters/MovementClass.h"
+#include "graphics/HexGrid.h"
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr int UNREACHED = -1;
+
+    // Cheapest cost from start to every tile under the rules A* uses: no
+    // units in the way, other factions' buildings only as the goal
+    std::vector<int> costsFrom(const NavigationGrid& grid, int start, int goal, const MovementCosts& costs,
+                               Allegiance faction) {
+        std::vector<int> cost(grid.getTileCount(), UNREACHED);
+        using Node = std::pair<int, int>;
+        std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open;
+        cost[start] = 0;
+        open.push({0, start});
+        while (!open.empty()) {
+            auto [distance, tile] = open.top();
+            open.pop();
+            if (distance != cost[tile]) {
+                continue;
+            }
+            for (int direction = 0; direction < 6; ++direction) {
+                int next = grid.getNeighbor(tile, direction);
+                if (next < 0 || !costs.canEnter(grid.getTerrain(next)) || grid.hasUnit(next)
+                    || (next != goal && grid.isBlockedFor(next, faction))) {
+                    continue;
+                }
+                int nextCost = distance + costs.getCost(grid.getTerrain(next));
+                if (cost[next] == UNREACHED || nextCost < cost[next]) {
+                    cost[next] = nextCost;
+                    open.push({nextCost, next});
+                }
+            }
+        }
+        return cost;
+    }
+
+    bool adjacent(const NavigationGrid& grid, int a, int b) {
+        for (int direction = 0; direction < 6; ++direction) {
+            if (grid.getNeighbor(a, direction) == b) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+TEST(PathfinderTest, FindsCheapestPathsAroundUnitsAndBuildings) {
+    HexGrid hexes(25, 77u);
+    NavigationGrid grid(hexes);
+    std::mt19937 random(9);
+    for (int i = 0; i < 150; ++i) {
+        grid.setUnit(static_cast<int>(random() % grid.getTileCount()), true);
+        grid.setBuilding(static_cast<int>(random() % grid.getTileCount()),
+                         static_cast<std::int8_t>(i % 2 ? Allegiance::ENEMY : Allegiance::FRIENDLY));
+    }
+    const MovementCosts& costs = movementCostsOf(MovementClass::Infantry);
+    LandmarkTable landmarks(costs);
+    landmarks.build(grid);
+
+    Pathfinder pathfinder;
+    std::vector<int> path;
+    int found = 0;
+    long plainNodes = 0;
+    long landmarkNodes = 0;
+    for (int query = 0; query < 200; ++query) {
+        int start = static_cast<int>(random() % grid.getTileCount());
+        int goal = static_cast<int>(random() % grid.getTileCount());
+        if (start == goal || grid.hasUnit(start)) {
+            continue;
+        }
+        std::vector<int> exact = costsFrom(grid, start, goal, costs, Allegiance::FRIENDLY);
+        bool reachable = exact[goal] != UNREACHED && costs.canEnter(grid.getTerrain(goal)) && !grid.hasUnit(goal);
+
+        ASSERT_EQ(pathfinder.findPath(grid, start, goal, costs, Allegiance::FRIENDLY, path), reachable)
+            << "from " << start << " to " << goal;
+        plainNodes += pathfinder.getNodesExpanded();
+        if (!reachable) {
+            EXPECT_TRUE(path.empty());
+            continue;
+        }
+        found++;
+        EXPECT_EQ(pathfinder.getPathCost(), exact[goal]);
+
+        // Walkable tile by tile, and it adds up to the reported cost
+        int previous = start;
+        int cost = 0;
+        for (int tile : path) {
+            ASSERT_TRUE(adjacent(grid, previous, tile));
+            cost += costs.getCost(grid.getTerrain(tile));
+            previous = tile;
+        }
+        EXPECT_EQ(previous, goal);
+        EXPECT_EQ(cost, exact[goal]);
+
+        // Landmarks only prune the search; the cost stays optimal
+        ASSERT_TRUE(pathfinder.findPath(grid, start, goal, costs, Allegiance::FRIENDLY, path, &landmarks));
+        EXPECT_EQ(pathfinder.getPathCost(), exact[goal]);
+        landmarkNodes += pathfinder.getNodesExpanded();
+    }
+    ASSERT_GT(found, 50);
+    EXPECT_LE(landmarkNodes, plainNodes);
+}
+
+TEST(PathfinderTest, RejectsOccupiedAndImpassableGoals) {
+    HexGrid hexes(5, 1u);
+    NavigationGrid grid(hexes);
+    for (int tile = 0; tile < grid.getTileCount(); ++tile) {
+        grid.setTerrain(tile, TerrainType::PLAINS);
+    }
+    const MovementCosts& costs = movementCostsOf(MovementClass::Tracked);
+    Pathfinder pathfinder;
+    std::vector<int> path;
+    int start = 0;
+    int goal = grid.getTileCount() - 1;
+
+    EXPECT_TRUE(pathfinder.findPath(grid, start, goal, costs, Allegiance::FRIENDLY, path));
+    EXPECT_FALSE(pathfinder.findPath(grid, start, start, costs, Allegiance::FRIENDLY, path));
+
+    grid.setUnit(goal, true);
+    EXPECT_FALSE(pathfinder.findPath(grid, start, goal, costs, Allegiance::FRIENDLY, path));
+    grid.setUnit(goal, false);
+
+    grid.setTerrain(goal, TerrainType::FOREST);
+    EXPECT_FALSE(pathfinder.findPath(grid, start, goal, costs, Allegiance::FRIENDLY, path));
+    EXPECT_TRUE(path.empty());
+
+    // An enemy building may be the goal, to be taken on arrival
+    grid.setTerrain(goal, TerrainType::URBAN);
+    grid.setBuilding(goal, static_cast<std::int8_t>(Allegiance::ENEMY));
+    EXPECT_TRUE(pathfinder.findPath(grid, start, goal, costs, Allegiance::FRIENDLY, path));
+}
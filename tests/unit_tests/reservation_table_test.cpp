@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "pathfinding/ReservationTable.h"
+#include <map>
+#include <random>
+
+namespace {
+    constexpr std::uint32_t A = 1;
+    constexpr std::uint32_t B = 2;
+}
+
+TEST(ReservationTableTest, TileHasOneOwnerPerStep) {
+    ReservationTable table(8);
+    EXPECT_TRUE(table.reserve(5, 0, A));
+    EXPECT_TRUE(table.reserve(5, 0, A));
+    EXPECT_FALSE(table.reserve(5, 0, B));
+    EXPECT_TRUE(table.reserve(5, 1, B));
+
+    EXPECT_EQ(table.getOwner(5, 0), A);
+    EXPECT_EQ(table.getOwner(5, 1), B);
+    EXPECT_EQ(table.getOwner(6, 0), ReservationTable::NO_OWNER);
+    EXPECT_TRUE(table.isReservedByOther(5, 0, B));
+    EXPECT_FALSE(table.isReservedByOther(5, 0, A));
+}
+
+TEST(ReservationTableTest, OnlyTheOwnerCanRelease) {
+    ReservationTable table(8);
+    ASSERT_TRUE(table.reserve(5, 0, A));
+    table.release(5, 0, B);
+    EXPECT_EQ(table.getOwner(5, 0), A);
+    table.release(5, 0, A);
+    EXPECT_EQ(table.getOwner(5, 0), ReservationTable::NO_OWNER);
+    EXPECT_EQ(table.getReservationCount(), 0u);
+}
+
+TEST(ReservationTableTest, FullBucketRefusesClaims) {
+    // Eight agents give 16 slots per step, one of which always stays empty
+    ReservationTable table(8);
+    for (int tile = 0; tile < 15; ++tile) {
+        ASSERT_TRUE(table.reserve(tile, 0, A)) << "tile " << tile;
+    }
+    EXPECT_FALSE(table.reserve(15, 0, A));
+    EXPECT_TRUE(table.reserve(15, 1, A));
+    for (int tile = 0; tile < 15; ++tile) {
+        EXPECT_EQ(table.getOwner(tile, 0), A);
+    }
+}
+
+TEST(ReservationTableTest, ReleaseKeepsEveryOtherEntryReachable) {
+    // Random claims and releases in a nearly full bucket make long probe runs,
+    // so the backward shift has to move entries across the wrap of the bucket
+    ReservationTable table(8);
+    std::map<int, std::uint32_t> expected;
+    std::mt19937 random(42);
+    for (int round = 0; round < 20000; ++round) {
+        int tile = static_cast<int>(random() % 40);
+        std::uint32_t owner = 1 + random() % 3;
+        auto it = expected.find(tile);
+        if (random() % 2) {
+            bool claimed = table.reserve(tile, 0, owner);
+            if (it != expected.end()) {
+                ASSERT_EQ(claimed, it->second == owner);
+            } else if (claimed) {
+                expected[tile] = owner;
+            } else {
+                ASSERT_EQ(expected.size(), 15u);
+            }
+        } else {
+            table.release(tile, 0, owner);
+            if (it != expected.end() && it->second == owner) {
+                expected.erase(it);
+            }
+        }
+
+        ASSERT_EQ(table.getReservationCount(), expected.size());
+        for (int check = 0; check < 40; ++check) {
+            auto found = expected.find(check);
+            ASSERT_EQ(table.getOwner(check, 0), found == expected.end() ? ReservationTable::NO_OWNER : found->second)
+                << "tile " << check << " after round " << round;
+        }
+    }
+}
+
+TEST(ReservationTableTest, WindowCoversHorizonSteps) {
+    ReservationTable table(8);
+    table.advanceTo(10);
+    EXPECT_FALSE(table.reserve(1, 9, A));
+    EXPECT_TRUE(table.reserve(1, 10, A));
+    EXPECT_TRUE(table.reserve(1, 10 + ReservationTable::HORIZON - 1, A));
+    EXPECT_FALSE(table.reserve(1, 10 + ReservationTable::HORIZON, A));
+}
+
+TEST(ReservationTableTest, RingReusesBucketsOfPastSteps) {
+    ReservationTable table(8);
+    ASSERT_TRUE(table.reserve(3, 0, A));
+    ASSERT_TRUE(table.reserve(4, 1, A));
+
+    // Step HORIZON lands in step 0's bucket; step 0's claim must be gone
+    table.advanceTo(1);
+    EXPECT_EQ(table.getOwner(3, 0), ReservationTable::NO_OWNER);
+    EXPECT_EQ(table.getReservationCount(), 1u);
+    EXPECT_TRUE(table.reserve(3, ReservationTable::HORIZON, B));
+    EXPECT_EQ(table.getOwner(3, ReservationTable::HORIZON), B);
+    EXPECT_EQ(table.getOwner(4, 1), A);
+}
+
+TEST(ReservationTableTest, JumpPastWholeWindowDropsEverything) {
+    ReservationTable table(8);
+    for (std::uint64_t step = 0; step < ReservationTable::HORIZON; ++step) {
+        ASSERT_TRUE(table.reserve(static_cast<int>(step), step, A));
+    }
+    table.advanceTo(1000);
+    EXPECT_EQ(table.getReservationCount(), 0u);
+    for (std::uint64_t step = 1000; step < 1000 + ReservationTable::HORIZON; ++step) {
+        EXPECT_EQ(table.getOwner(static_cast<int>(step % ReservationTable::HORIZON), step),
+                  ReservationTable::NO_OWNER);
+    }
+}
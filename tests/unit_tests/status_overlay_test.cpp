@@ -0,0 +1,42 @@
+#include <gtest/gtest.h>
+#include "graphics/StatusOverlay.h"
+#include "graphics/TextureManager.h"
+#include "characters/Soldier.h"
+
+TEST(StatusOverlayTest, ReloadRewritesTheSlotInSteps) {
+    TextureManager::getInstance().setTexturesEnabled(false);
+    Soldier soldier(0, 0);
+    soldier.resetShootCooldown(60);
+
+    StatusOverlay overlay;
+    overlay.beginFrame();
+    overlay.updateCharacter(soldier, true);
+    overlay.endFrame();
+
+    // One rewrite per step of the bar at most, not one per tick
+    std::size_t rewrites = 0;
+    for (int tick = 0; tick < 60; ++tick) {
+        soldier.updateCooldowns(1.f);
+        overlay.beginFrame();
+        overlay.updateCharacter(soldier, true);
+        overlay.endFrame();
+        rewrites += overlay.getRebuiltCount();
+    }
+    EXPECT_TRUE(soldier.canShoot());
+    EXPECT_GT(rewrites, 0u);
+    EXPECT_LE(rewrites, 16u);
+
+    // Nothing changed, so the vertices and their revision stay as they are
+    std::uint64_t revision = overlay.getRevision();
+    overlay.beginFrame();
+    overlay.updateCharacter(soldier, true);
+    overlay.endFrame();
+    EXPECT_EQ(overlay.getRebuiltCount(), 0u);
+    EXPECT_EQ(overlay.getRevision(), revision);
+
+    // Losing the entity clears its slot
+    overlay.beginFrame();
+    overlay.endFrame();
+    EXPECT_NE(overlay.getRevision(), revision);
+    TextureManager::getInstance().setTexturesEnabled(true);
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "graphics/TripleBuffer.h"
+#include <array>
+#include <thread>
+
+namespace {
+    // Every field carries the same value, so a torn read shows up as a mismatch
+    struct Frame {
+        std::array<int, 64> values{};
+    };
+}
+
+TEST(TripleBufferTest, NothingToAcquireBeforeFirstPublish) {
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.acquire());
+}
+
+TEST(TripleBufferTest, AcquireTakesEachPublishOnce) {
+    TripleBuffer<int> buffer;
+    buffer.writeBuffer() = 7;
+    buffer.publish();
+
+    ASSERT_TRUE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 7);
+    EXPECT_FALSE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 7);
+}
+
+TEST(TripleBufferTest, AcquireSkipsToLatestPublish) {
+    TripleBuffer<int> buffer;
+    for (int value = 1; value <= 5; ++value) {
+        buffer.writeBuffer() = value;
+        buffer.publish();
+    }
+
+    ASSERT_TRUE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 5);
+}
+
+TEST(TripleBufferTest, ProducerNeverWritesTheBufferBeingRead) {
+    TripleBuffer<int> buffer;
+    buffer.writeBuffer() = 1;
+    buffer.publish();
+    ASSERT_TRUE(buffer.acquire());
+
+    // Two more publishes cycle the producer through both other buffers
+    for (int value = 2; value <= 3; ++value) {
+        buffer.writeBuffer() = value;
+        buffer.publish();
+        EXPECT_EQ(buffer.readBuffer(), 1);
+    }
+}
+
+TEST(TripleBufferTest, ConsumerSeesWholeFramesInOrder) {
+    constexpr int FRAMES = 200000;
+    TripleBuffer<Frame> buffer;
+
+    std::thread producer([&buffer]() {
+        for (int frame = 1; frame <= FRAMES; ++frame) {
+            buffer.writeBuffer().values.fill(frame);
+            buffer.publish();
+        }
+    });
+
+    int last = 0;
+    bool torn = false;
+    bool reordered = false;
+    while (last < FRAMES) {
+        if (!buffer.acquire()) {
+            std::this_thread::yield();
+            continue;
+        }
+        const Frame& frame = buffer.readBuffer();
+        int value = frame.values[0];
+        for (int v : frame.values) {
+            torn = torn || v != value;
+        }
+        reordered = reordered || value <= last;
+        last = value;
+    }
+    producer.join();
+
+    EXPECT_FALSE(torn);
+    EXPECT_FALSE(reordered);
+    EXPECT_EQ(last, FRAMES);
+}
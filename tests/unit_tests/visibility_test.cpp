@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+#include "graphics/VisibilitySystem.h"
+#include "graphics/HexGrid.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+    constexpr int RANGE = 6;
+
+    Hexagon::CubeCoord cube(int q, int r) {
+        return Hexagon::CubeCoord(q, r, -q - r);
+    }
+
+    void clearTerrain(HexGrid& hexes) {
+        for (int tile = 0; tile < hexes.getTileCount(); ++tile) {
+            hexes.getTile(tile)->setTerrainType(TerrainType::PLAINS);
+        }
+    }
+
+    void setTerrain(HexGrid& hexes, int q, int r, TerrainType terrain) {
+        hexes.getHexAt(cube(q, r))->setTerrainType(terrain);
+    }
+
+    bool seenByEnemy(const HexGrid& hexes, int q, int r) {
+        return hexes.getHexAt(cube(q, r))->isVisibleTo(Allegiance::ENEMY);
+    }
+
+    // Trace one nudged line from the origin to (dq, dr) and report whether
+    // any hex strictly between them blocks sight
+    bool lineClear(const HexGrid& hexes, int dq, int dr, float nudge) {
+        int d = (std::abs(dq) + std::abs(dr) + std::abs(dq + dr)) / 2;
+        for (int k = 1; k < d; ++k) {
+            float t = static_cast<float>(k) / static_cast<float>(d);
+            float q = dq * t + nudge;
+            float r = dr * t + 2 * nudge;
+            float s = -(dq + dr) * t - 3 * nudge;
+            int rq = static_cast<int>(std::round(q));
+            int rr = static_cast<int>(std::round(r));
+            int rs = static_cast<int>(std::round(s));
+            float errQ = std::abs(rq - q);
+            float errR = std::abs(rr - r);
+            float errS = std::abs(rs - s);
+            if (errQ > errR && errQ > errS) {
+                rq = -rr - rs;
+            } else if (errR > errS) {
+                rr = -rq - rs;
+            }
+            if (VisibilitySystem::blocksSight(hexes.getHexAt(cube(rq, rr))->getTerrainType())) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST(VisibilityTest, ForestHidesTheTileStraightBehindIt) {
+    HexGrid hexes(10, 1u);
+    clearTerrain(hexes);
+    setTerrain(hexes, 1, 0, TerrainType::FOREST);
+
+    VisibilitySystem visibility;
+    visibility.addObserver(hexes, 1, Allegiance::ENEMY, cube(0, 0), RANGE, true);
+
+    EXPECT_TRUE(seenByEnemy(hexes, 1, 0));     // The forest itself
+    for (int q = 2; q <= RANGE; ++q) {
+        EXPECT_FALSE(seenByEnemy(hexes, q, 0)) << "q=" << q;
+    }
+    EXPECT_TRUE(seenByEnemy(hexes, 0, 1));     // Beside it
+    EXPECT_TRUE(seenByEnemy(hexes, 2, -2));
+}
+
+TEST(VisibilityTest, EdgeLinesNeedOneClearSide) {
+    HexGrid hexes(10, 1u);
+    clearTerrain(hexes);
+    // (1, -2) sits exactly between (1, -1) and (0, -1) as seen from the origin
+    setTerrain(hexes, 1, -1, TerrainType::FOREST);
+
+    VisibilitySystem visibility;
+    visibility.addObserver(hexes, 1, Allegiance::ENEMY, cube(0, 0), RANGE, true);
+    EXPECT_TRUE(seenByEnemy(hexes, 1, -2));
+
+    visibility.removeObserver(hexes, 1);
+    setTerrain(hexes, 0, -1, TerrainType::URBAN);
+    visibility.addObserver(hexes, 1, Allegiance::ENEMY, cube(0, 0), RANGE, true);
+    EXPECT_FALSE(seenByEnemy(hexes, 1, -2));
+    EXPECT_FALSE(seenByEnemy(hexes, 2, -4));
+}
+
+TEST(VisibilityTest, MatchesTracingEachLine) {
+    std::mt19937 random(7u);
+    for (int round = 0; round < 20; ++round) {
+        HexGrid hexes(10, 1u);
+        clearTerrain(hexes);
+        for (int tile = 0; tile < hexes.getTileCount(); ++tile) {
+            if (random() % 5 == 0) {
+                hexes.getTile(tile)->setTerrainType(random() % 2 ? TerrainType::FOREST : TerrainType::URBAN);
+            }
+        }
+
+        VisibilitySystem visibility;
+        visibility.addObserver(hexes, 1, Allegiance::ENEMY, cube(0, 0), RANGE, true);
+
+        for (int dq = -RANGE; dq <= RANGE; ++dq) {
+            for (int dr = std::max(-RANGE, -dq - RANGE); dr <= std::min(RANGE, -dq + RANGE); ++dr) {
+                bool expected = lineClear(hexes, dq, dr, 1e-4f) || lineClear(hexes, dq, dr, -1e-4f);
+                EXPECT_EQ(seenByEnemy(hexes, dq, dr), expected) << "round " << round << " at " << dq << "," << dr;
+            }
+        }
+    }
+}
+
+TEST(VisibilityTest, ChangesReplayIntoTheNewVisibility) {
+    HexGrid hexes(12, 3u);
+    VisibilitySystem visibility;
+    std::mt19937 random(11u);
+
+    auto snapshot = [&hexes]() {
+        std::vector<std::uint8_t> bits(hexes.getTileCount());
+        for (int tile = 0; tile < hexes.getTileCount(); ++tile) {
+            for (int faction = 0; faction < FACTION_COUNT; ++faction) {
+                if (hexes.getTile(tile)->isVisibleTo(static_cast<Allegiance>(faction))) {
+                    bits[tile] |= factionBit(static_cast<Allegiance>(faction));
+                }
+            }
+        }
+        return bits;
+    };
+    auto randomTile = [&]() {
+        return hexes.getTile(static_cast<int>(random() % hexes.getTileCount()))->getCoord();
+    };
+
+    for (int tick = 0; tick < 200; ++tick) {
+        std::vector<std::uint8_t> replayed = snapshot();
+        visibility.beginTick();
+
+        // A few observer changes per tick, any faction, some with line of sight
+        for (int step = 0; step < 3; ++step) {
+            auto id = static_cast<VisibilitySystem::ObserverId>(random() % 8 + 1);
+            if (!visibility.hasObserver(id)) {
+                visibility.addObserver(hexes, id, static_cast<Allegiance>(random() % FACTION_COUNT), randomTile(),
+                                       static_cast<int>(random() % 4 + 1), random() % 2 == 0);
+            } else if (random() % 4 == 0) {
+                visibility.removeObserver(hexes, id);
+            } else {
+                visibility.moveObserver(hexes, id, randomTile());
+            }
+        }
+
+        for (const auto& change : visibility.getChanges()) {
+            std::uint8_t bit = factionBit(change.faction);
+            ASSERT_EQ((replayed[change.tile] & bit) != 0, !change.becameVisible) << "tick " << tick;
+            replayed[change.tile] ^= bit;
+        }
+        ASSERT_EQ(replayed, snapshot()) << "tick " << tick;
+    }
+}